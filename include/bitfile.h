@@ -17,6 +17,10 @@
 /** History
  *
  * 2008-03-10: Added bitfile position header, skip_* functions
+ * 2026-10-17: Widened the bit buffer to 64-bits for word refills
+ *             Added bitfile_read_delta
+ *             Added bitfile_zeta_table
+ *             Added Golomb and skewed Golomb codes
  */
 
 #include <stdio.h>
@@ -50,8 +54,10 @@ struct bitfile_tag {
 
     unsigned long long total_bits_read; ///< total bits read
 
-    size_t current; ///< the current bit buffer
+    uint64_t current; ///< the current bit buffer
     /** @remarks
+     * the bit buffer holds up to 63 bits, which are refilled
+     * a 64-bit word at a time when at least 8 bytes are available.
      * the bits current & (2 << fill - 1) yield the next bits
      * in the file, where the subsequent bits are exactly:
      * \code
@@ -72,6 +78,11 @@ struct bitfile_tag {
  */
 typedef struct bitfile_tag bitfile;
 
+/** The largest zeta_k with a lookup table, see bitfile_zeta_table */
+#define BITFILE_MAX_ZETA_TABLE_K 7
+/** The largest Golomb modulus with a lookup table */
+#define BITFILE_MAX_GOLOMB_TABLE_B 1024
+
 int bitfile_open(FILE* f, bitfile* bf);
 int bitfile_map(unsigned char* mem, size_t len, bitfile *bf);
 int bitfile_close(bitfile* bf);
@@ -81,8 +92,15 @@ int bitfile_read_bit(bitfile* bf);
 int64_t bitfile_read_int(bitfile* bf, unsigned int len);
 int bitfile_read_unary(bitfile* bf);
 int64_t bitfile_read_gamma(bitfile* bf);
+int64_t bitfile_read_delta(bitfile* bf);
 int64_t bitfile_read_zeta(bitfile* bf, const int k);
 int64_t bitfile_read_nibble(bitfile* bf);
+int64_t bitfile_read_golomb(bitfile* bf, const int b);
+int64_t bitfile_read_skewed_golomb(bitfile* bf, const int b);
+
+const int* bitfile_zeta_table(const int k);
+const int* bitfile_golomb_table(const int b);
+const int* bitfile_skewed_golomb_table(const int b);
 
 long long bitfile_tell(bitfile* bf);
 int bitfile_position(bitfile* bf, const long long pos);
@@ -27,10 +27,34 @@
  * 2008-05-08: Added iterator_copy
  * 2008-05-09: Added parallel iterators
  *           Added BVGRAPH_VERBOSE macro
+ * 2026-10-17: Added Golomb parameters for each component
+ *           Added bvgraph_load_mmap
+ *           Added flags to bvgraph_load_external, bvgraph_hugepage_usage
+ *           Added Elias-Fano offsets
+ *           Added the 32-bit bvgraph_iterator32
+ *           Removed buf1 and buf2 from the iterator types
+ *           Added bvgraph_iterator_seek, bvgraph_foreach and 
+ *           bvgraph_foreach_batch
+ *           Added bvgraph_csr_chunk and bvgraph_iterator_next_batch
+ *           Added bvgraph_async_iterator
+ *           Added bvgraph_outdegree_iterator, bvgraph_outdegrees and the
+ *           outdegree cache in the graph
+ *           Added iterator checkpoints saved to a .checkpoints file
+ *           Replaced successors and ref_successors in the random iterator
+ *           with the reference chain buffers
+ *           Added the successor cache of the random iterator, removed 
+ *           struct successor and the global cache functions
+ *           Added the shared successor cache of a graph
+ *           Added bvgraph_random_successors_batch
+ *           Added bvgraph_has_arc
+ *           Added bvgraph_call_buffer_too_small
+ *           Added the earlier outdegree windows of the random iterator
+ *           and the last node of its walks
  */
 
 
 #include "bitfile.h"
+#include "eflist.h"
 
 //#define MAX_DEBUG
 
@@ -39,7 +63,6 @@
 #endif
 
 #define BVGRAPH_MAX_FILENAME_SIZE 1024
-#define MAX_CACHE_SIZE 10000
 
 #ifdef __cplusplus
 extern "C" {
@@ -67,6 +90,40 @@ enum bvgraph_compression_flag_tag {
  */
 typedef enum bvgraph_compression_flag_tag bvgraph_compression_flag;
 
+/**
+ * @brief load flags for bvgraph_load_external
+ * The enum records the options for how a graph is held in memory.
+ */
+enum bvgraph_load_flag_tag {
+    BVGRAPH_LOAD_MMAP = 1,      ///< map the .graph file instead of reading it
+    BVGRAPH_LOAD_HUGEPAGES = 2, ///< allocate the graph and offsets on huge pages
+    BVGRAPH_LOAD_POPULATE = 4,  ///< pre-fault a mapped graph
+    BVGRAPH_LOAD_EF_OFFSETS = 8, ///< store the offsets as an Elias-Fano list
+    BVGRAPH_LOAD_SAVE_OFFSETS = 16, ///< save rebuilt offsets to a .offsets file
+    BVGRAPH_LOAD_SAVE_EF_OFFSETS = 32, ///< save rebuilt offsets to a .ef file
+};
+
+/**
+ * \typedef bvgraph_load_flag
+ */
+typedef enum bvgraph_load_flag_tag bvgraph_load_flag;
+
+/**
+ * @struct bvgraph_checkpoints_tag
+ * @brief iterator checkpoints from a .checkpoints file
+ *
+ * The state of a sequential iterator at every step-th node, saved by
+ * bvgraph_save_checkpoints and loaded by bvgraph_load_checkpoints.  
+ * Checkpoint k is the iterator with curr = k*step: the bit position 
+ * after node k*step and the successors of the nodes in its window.
+ */
+struct bvgraph_checkpoints_tag {
+    int64_t step;       ///< the number of nodes between checkpoints
+    int64_t count;      ///< the number of checkpoints
+    uint64_t* index;    ///< the start of each checkpoint in data, count+1 entries
+    int64_t* data;      ///< the checkpoints, see bvgraph_checkpoint.c
+};
+
 /**
  * @brief bvgraph structure class
  * 
@@ -97,15 +154,30 @@ struct bvgraph_tag {
     enum bvgraph_compression_flag_tag block_count_coding;
     enum bvgraph_compression_flag_tag offset_coding;
 
+    // Golomb moduli for components with GOLOMB or SKEWED_GOLOMB coding
+    int outdegree_golomb_b;
+    int block_golomb_b;
+    int residual_golomb_b;
+    int reference_golomb_b;
+    int block_count_golomb_b;
+    int offset_golomb_b;
+
     // graph load information
     int offset_step; ///< -1: not store graph in memory; 0: store graph; 1: store offset
 
     unsigned char* memory;
     size_t memory_size;
     int memory_external;
+    int memory_mapped; ///< true if memory is a read-only mapping of the .graph file
 
     unsigned long long* offsets;
     int offsets_external;
+    elias_fano_list ef_offsets; ///< the offsets with BVGRAPH_LOAD_EF_OFFSETS
+    int offsets_ef; ///< true if the offsets are in ef_offsets
+
+    int64_t* outdegrees; ///< the outdegrees from bvgraph_cache_outdegrees, or NULL
+    struct bvgraph_checkpoints_tag* checkpoints; ///< from bvgraph_load_checkpoints, or NULL
+    struct bvgraph_shared_cache_tag* shared_cache; ///< from bvgraph_shared_cache_create, or NULL
 };
 
 /** 
@@ -124,6 +196,16 @@ struct bvgraph_int_vector_tag {
     int64_t* a;
 };
 
+/** 
+ * @struct bvgraph_int32_vector_tag
+ * @brief iternal struct for bvgraph_int32_vector
+ * The 32-bit version of bvgraph_int_vector used in bvgraph_iterator32.
+ */
+struct bvgraph_int32_vector_tag {
+    uint64_t elements;
+    uint32_t* a;
+};
+
 /**
  * @struct bvgraph_iterator_tag
  * @brief implementation of bvgraph_iterator
@@ -150,19 +232,126 @@ struct bvgraph_iterator_tag {
 
     // variables used inside the next function
     int64_t max_outd;
-    struct bvgraph_int_vector_tag block, left, len, buf1, buf2;
+    struct bvgraph_int_vector_tag block, left, len;
 };
 
+/** The largest graph that a bvgraph_iterator32 can iterate over */
+#define BVGRAPH_ITERATOR32_MAX_NODES (UINT64_C(1) << 32)
+
 /**
- * @struct successor
- * @brief successor struct
+ * @struct bvgraph_iterator32_tag
+ * @brief implementation of bvgraph_iterator32
+ * A sequential access iterator for graphs with at most 2^32 nodes.
+ *
+ * Use this type through its alias bvgraph_iterator32.
+ *
+ * The fields are the same as bvgraph_iterator, except that the window
+ * and the successor arrays store 32-bit node ids, which halves the 
+ * memory traffic of the merges and of consumers of the successors.
  */
+struct bvgraph_iterator32_tag {
+    // variables that will be maintained for a public interface
+    int64_t curr;   ///< current node id
+    struct bvgraph_tag* g;
+    bitfile bf;
+
+    // implementation dependent variables
+    int cyclic_buffer_size;
+    int64_t* outd_cache;
+    struct bvgraph_int32_vector_tag* window;
+
+    struct bvgraph_int32_vector_tag successors; 
+    int64_t curr_outd;
 
-struct successor{
-    int64_t node;   ///< key
-    int64_t* a;     ///< a list of successors
-    int64_t d;      ///< number of degree
-    int loaded;   ///< number of usage
+    // variables used inside the next function
+    int64_t max_outd;
+    struct bvgraph_int_vector_tag block, left, len;
+};
+
+/**
+ * @struct bvgraph_csr_chunk_tag
+ * @brief implementation of bvgraph_csr_chunk
+ * The successors of consecutive nodes in compressed sparse row form, 
+ * filled by bvgraph_iterator_next_batch, or of a batch of queries, 
+ * filled by bvgraph_random_successors_batch.
+ *
+ * The caller provides the arrays rowstart and links.  The successors of
+ * node first+k are links[rowstart[k]] to links[rowstart[k+1]-1].
+ */
+struct bvgraph_csr_chunk_tag {
+    int64_t first;      ///< the first node in the chunk
+    int64_t nodes;      ///< the number of nodes in the chunk
+    uint64_t edges;     ///< the number of edges in the chunk
+    uint64_t *rowstart; ///< row pointers, at least max_nodes+1 entries
+    int64_t *links;     ///< successors, at least max_edges entries
+};
+
+/**
+ * @struct bvgraph_async_iterator_tag
+ * @brief implementation of bvgraph_async_iterator
+ * A sequential iterator that decodes the graph on a helper thread.
+ *
+ * Use this type through its alias bvgraph_async_iterator.
+ *
+ * The helper thread fills a ring of bvgraph_csr_chunk while the 
+ * caller works through the current chunk.  The current node is 
+ * chunk->first + chunk_index.
+ */
+struct bvgraph_async_iterator_tag {
+    int64_t curr;       ///< current node id
+    struct bvgraph_tag* g;
+    int64_t curr_outd;  ///< the outdegree of the current node
+    
+    const struct bvgraph_csr_chunk_tag* chunk; ///< the chunk with curr
+    int64_t chunk_index;    ///< the index of curr in chunk
+    void* state;            ///< the decoder, internal to bvgraph_iterator.c
+};
+
+/**
+ * @struct bvgraph_successor_cache_tag
+ * @brief a bounded cache of successor lists in a random access iterator
+ *
+ * Set the budget with bvgraph_random_cache_size.  Lists are evicted 
+ * with the CLOCK algorithm: a list that was found since the clock hand
+ * last passed it gets a second chance.
+ */
+struct bvgraph_successor_cache_tag {
+    size_t budget;      ///< the largest number of bytes in the cache, 0 for none
+    size_t bytes;       ///< the bytes in the cache
+    uint64_t hits;      ///< the lookups of queries and references found
+    uint64_t misses;    ///< the lookups decoded from the graph
+    struct bvgraph_cache_entry_tag* entries; ///< internal to bvgraph_random.c
+    struct bvgraph_cache_entry_tag* hand;    ///< the next entry for the clock
+};
+
+/**
+ * @struct bvgraph_shared_list_tag
+ * @brief an immutable successor list from the shared cache of a graph
+ *
+ * The list is reference counted: it stays valid after the cache evicts
+ * it until each holder calls bvgraph_shared_list_release.
+ */
+struct bvgraph_shared_list_tag {
+    int64_t x;          ///< the node
+    int64_t d;          ///< its outdegree
+    const int64_t* a;   ///< its successors
+};
+
+/**
+ * @struct bvgraph_chain_level_tag
+ * @brief one node of a reference chain in a random access iterator
+ *
+ * bvgraph_random_successors walks the chain of references of a node 
+ * into these levels, then decodes them from the deepest one up.
+ */
+struct bvgraph_chain_level_tag {
+    int64_t x;          ///< the node
+    int64_t d;          ///< its outdegree
+    int64_t ref;        ///< its reference, or a value <= 0 for none
+    long long pos;      ///< the bit position after the reference
+    struct bvgraph_int_vector_tag links; ///< its successors, when decoded
+    int64_t* a;         ///< its successors, in links or in the cache
+    int cached;         ///< true if the successors came from the cache
 };
 
 /** 
@@ -200,7 +389,11 @@ struct bvgraph_random_iterator_tag {
     
     int64_t cache_start;  ///< the start of both caches
     
-    struct successor *successors_cache; ///< a cache for successors
+    struct bvgraph_successor_cache_tag cache; ///< a cache for successors
+    
+    /** the list from the shared cache of the graph that holds the 
+     * successors of the last query, or NULL */
+    struct bvgraph_shared_list_tag* shared;
 
     // a table to maintain the top k loaded nodes
     // int* top_loaded;
@@ -208,13 +401,57 @@ struct bvgraph_random_iterator_tag {
     int cyclic_buffer_size;
     struct bvgraph_int_vector_tag* window;
 
-    struct bvgraph_int_vector_tag successors; 
-    struct bvgraph_int_vector_tag ref_successors;
     int64_t curr_outd;
 
     // variables used inside the next function
     int64_t max_outd;
-    struct bvgraph_int_vector_tag block, left, len, buf1, buf2;
+    struct bvgraph_int_vector_tag block, left, len;
+
+    /** with offset_step > 1, a direct mapped cache of (node, outdegree)
+     * pairs from earlier walks, so skipping a node rarely needs to walk 
+     * back into the previous blocks */
+    int64_t *outd_memo;
+
+    /** with offset_step > 1, the outdegree windows of the walks into
+     * previous blocks, earlier_outd[k] for the k-th nested walk */
+    int64_t **earlier_outd;
+    int earlier_size;   ///< the number of windows allocated in earlier_outd
+    int earlier_depth;  ///< the number of windows used by the current walks
+
+    /** with offset_step > 1, the last node the walks of bf reached, or -1,
+     * and the bit positions after the outdegrees of its window in a 
+     * cyclic buffer; the outdegrees are in outd_cache */
+    int64_t walk_node;
+    int64_t *walk_pos;
+
+    /** the reference chain of the last query, chain[0] is the node and
+     * chain[k+1] is the reference of chain[k] */
+    struct bvgraph_chain_level_tag* chain;
+    int chain_size; ///< the number of levels allocated in chain
+};
+
+/**
+ * @struct bvgraph_outdegree_iterator_tag
+ * @brief implementation of bvgraph_outdegree_iterator
+ * A sequential iterator over the outdegrees of a range of nodes.
+ *
+ * Use this type through its alias bvgraph_outdegree_iterator.
+ *
+ * The iterator reads the outdegree of each node and skips its successor
+ * list instead of decoding it.
+ */
+struct bvgraph_outdegree_iterator_tag {
+    int64_t curr;       ///< current node id
+    struct bvgraph_tag* g;
+    int64_t curr_outd;  ///< the outdegree of the current node
+    int64_t end;        ///< one past the last node
+
+    // implementation dependent variables
+    bitfile bf;
+    int64_t walk_start; ///< the first node skipped in bf, -1 to read each offset
+    int cyclic_buffer_size;
+    int64_t* outd;      ///< the outdegrees of the last cyclic_buffer_size nodes
+    struct bvgraph_random_iterator_tag* ri; ///< for references before walk_start
 };
 
 /**
@@ -233,12 +470,39 @@ typedef struct bvgraph_tag bvgraph;
 typedef struct bvgraph_iterator_tag bvgraph_iterator;
 typedef struct bvgraph_random_iterator_tag bvgraph_random_iterator;
 typedef struct bvgraph_int_vector_tag bvgraph_int_vector;
+typedef struct bvgraph_iterator32_tag bvgraph_iterator32;
+typedef struct bvgraph_int32_vector_tag bvgraph_int32_vector;
+typedef struct bvgraph_csr_chunk_tag bvgraph_csr_chunk;
+typedef struct bvgraph_async_iterator_tag bvgraph_async_iterator;
+typedef struct bvgraph_outdegree_iterator_tag bvgraph_outdegree_iterator;
+typedef struct bvgraph_checkpoints_tag bvgraph_checkpoints;
+typedef struct bvgraph_successor_cache_tag bvgraph_successor_cache;
+typedef struct bvgraph_shared_list_tag bvgraph_shared_list;
+
+/** 
+ * The callback of bvgraph_foreach, called with the successors of node x.
+ * The successors are internal memory that is only valid during the call.
+ * Return 0 to continue, anything else stops bvgraph_foreach.
+ */
+typedef int (*bvgraph_visitor)(void *ctx, int64_t x, 
+                               const int64_t *links, uint64_t d);
+
+/**
+ * The callback of bvgraph_foreach_batch, called with the successors of the
+ * nodes first to first+count-1.  The successors of node first+k are 
+ * links[start[k]] to links[start[k+1]-1].  Return 0 to continue, 
+ * anything else stops bvgraph_foreach_batch.
+ */
+typedef int (*bvgraph_batch_visitor)(void *ctx, int64_t first, int64_t count,
+                                     const uint64_t *start, 
+                                     const int64_t *links);
 typedef struct bvgraph_parallel_iterators_tag bvgraph_parallel_iterators;
 
 // define all the error codes
 extern const int bvgraph_call_out_of_memory;
 extern const int bvgraph_call_io_error;
 extern const int bvgraph_call_unsupported;
+extern const int bvgraph_call_buffer_too_small;
 
 extern const int bvgraph_load_error_filename_too_long;
 extern const int bvgraph_load_error_buffer_too_small;
@@ -261,9 +525,16 @@ int bvgraph_load_external(bvgraph *g,
                           const char *filename, unsigned int filenamelen, 
                           int offset_step,
                           unsigned char *gmemory, size_t gmemsize,
-                          unsigned long long* offsets, int offsetssize);
+                          unsigned long long* offsets, int offsetssize,
+                          int flags);
+
+int bvgraph_load_mmap(bvgraph *g,
+                      const char *filename, unsigned int filenamelen, 
+                      int offset_step);
 
 int bvgraph_close(bvgraph* g);
+int bvgraph_hugepage_usage(bvgraph *g, size_t *memory_bytes, 
+                           size_t *offsets_bytes);
 int bvgraph_nonzero_iterator(bvgraph* g, bvgraph_iterator *i);
 int bvgraph_random_access_iterator(bvgraph* g, bvgraph_random_iterator *ri);
 
@@ -275,12 +546,61 @@ int bvgraph_iterator_outedges(bvgraph_iterator* i,
 int bvgraph_iterator_next(bvgraph_iterator* i);
 int bvgraph_iterator_valid(bvgraph_iterator* i);
 int bvgraph_iterator_free(bvgraph_iterator *i);
+int bvgraph_iterator_seek(bvgraph_iterator *i, int64_t x);
+int bvgraph_iterator_next_batch(bvgraph_iterator *i, int64_t max_nodes,
+                                uint64_t max_edges, bvgraph_csr_chunk *chunk);
+
+int bvgraph_foreach(bvgraph *g, int64_t start, int64_t end,
+                    bvgraph_visitor visit, void *ctx);
+int bvgraph_foreach_batch(bvgraph *g, int64_t start, int64_t end, 
+                          int64_t batch, bvgraph_batch_visitor visit, 
+                          void *ctx);
+
+int bvgraph_async_nonzero_iterator(bvgraph* g, bvgraph_async_iterator *i, int depth);
+int bvgraph_async_iterator_outedges(bvgraph_async_iterator* i, 
+                                    int64_t** start, uint64_t* len);
+int bvgraph_async_iterator_next(bvgraph_async_iterator* i);
+int bvgraph_async_iterator_next_chunk(bvgraph_async_iterator* i);
+int bvgraph_async_iterator_valid(bvgraph_async_iterator* i);
+int bvgraph_async_iterator_free(bvgraph_async_iterator *i);
+
+int bvgraph_outdegree_range_iterator(bvgraph *g, int64_t start, int64_t end,
+                                     bvgraph_outdegree_iterator *i);
+int bvgraph_outdegree_iterator_next(bvgraph_outdegree_iterator *i);
+int bvgraph_outdegree_iterator_valid(bvgraph_outdegree_iterator *i);
+int bvgraph_outdegree_iterator_free(bvgraph_outdegree_iterator *i);
+int bvgraph_outdegrees(bvgraph *g, int64_t *out);
+int bvgraph_outdegrees_range(bvgraph *g, int64_t start, int64_t end,
+                             int64_t *out);
+int bvgraph_cache_outdegrees(bvgraph *g);
+
+int bvgraph_save_checkpoints(bvgraph *g, int64_t step);
+int bvgraph_load_checkpoints(bvgraph *g);
+
+int bvgraph_nonzero_iterator32(bvgraph* g, bvgraph_iterator32 *i);
+int bvgraph_iterator32_outedges(bvgraph_iterator32* i, 
+                                uint32_t** start, uint64_t* len);
+int bvgraph_iterator32_next(bvgraph_iterator32* i);
+int bvgraph_iterator32_valid(bvgraph_iterator32* i);
+int bvgraph_iterator32_free(bvgraph_iterator32 *i);
 
 int bvgraph_random_outdegree(bvgraph_random_iterator *ri, 
                              int64_t x, uint64_t *d);
 int bvgraph_random_successors(bvgraph_random_iterator *ri, 
                              int64_t x, int64_t** start, uint64_t *length);
 int bvgraph_random_free(bvgraph_random_iterator *ri);
+int bvgraph_random_successors_batch(bvgraph_random_iterator *ri,
+                                    const int64_t *nodes, size_t k,
+                                    uint64_t max_edges, bvgraph_csr_chunk *out);
+int bvgraph_has_arc(bvgraph_random_iterator *ri, int64_t x, int64_t y, int *arc);
+int bvgraph_random_cache_size(bvgraph_random_iterator *ri, size_t bytes);
+int bvgraph_random_shared_successors(bvgraph_random_iterator *ri, 
+                                     int64_t x, bvgraph_shared_list **list);
+int bvgraph_shared_list_release(bvgraph_shared_list *list);
+
+int bvgraph_shared_cache_create(bvgraph *g, size_t bytes, int nshards);
+int bvgraph_shared_cache_stats(bvgraph *g, uint64_t *hits, uint64_t *misses,
+                               size_t *bytes);
 
 int bvgraph_iterator_copy(bvgraph_iterator *i, bvgraph_iterator *j);
 
@@ -296,13 +616,11 @@ int bvgraph_required_memory(bvgraph *g,
 
 int merge_int_arrays(const int64_t* a1, size_t a1len, const int64_t* a2,
                              size_t a2len, int64_t *out, size_t outlen);
+int merge_int32_arrays(const uint32_t* a1, size_t a1len, const uint32_t* a2,
+                       size_t a2len, uint32_t *out, size_t outlen);
 
 const char* bvgraph_error_string(int error);
 
-int add_to_cache(int node, int *links, int d);
-int loaded_sort(struct successor *a, struct successor *b);
-struct successor *find_in_cache(int node);
-
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,99 @@
+#ifndef LIBBVG_BVGRAPH_FOREACH_HPP
+#define LIBBVG_BVGRAPH_FOREACH_HPP
+
+/*
+ * David Gleich
+ * Copyright, Stanford University, 2026
+ * 17 October 2026
+ */
+
+/**
+ * @file bvgraph_foreach.hpp
+ * A header only C++ version of bvgraph_foreach that inlines its visitor.
+ *
+ * Usage:
+ *   struct colsum {
+ *       double *x;
+ *       void operator()(int64_t v, const int64_t *links, uint64_t d) {
+ *           for (uint64_t i = 0; i < d; i++) { x[links[i]] += 1.; }
+ *       }
+ *   };
+ *   colsum f = {x};
+ *   bvgraph_foreach(g, 0, g->n, f);
+ */
+
+/** History
+ *
+ * 2026-10-17: Initial version
+ *             Added bvgraph_foreach_async
+ */
+
+#include "bvgraph.h"
+
+/** Call a functor with the successors of each node in a range.
+ *
+ * The loop runs over the fields of a sequential iterator, so the
+ * only call per node that is not inlined is bvgraph_iterator_next.
+ *
+ * @param[in] g the graph
+ * @param[in] start the first node
+ * @param[in] end one past the last node, at most g->n
+ * @param[in] visit a functor called as visit(x, links, d) for each node
+ * @return 0 on success
+ */
+template <class Visitor>
+int bvgraph_foreach(bvgraph *g, int64_t start, int64_t end, Visitor& visit)
+{
+    bvgraph_iterator iter;
+    int rval;
+
+    if (start < 0 || start > end || end > g->n) {
+        return bvgraph_vertex_out_of_range;
+    }
+    if (start == end) { return (0); }
+
+    rval = bvgraph_nonzero_iterator(g, &iter);
+    if (rval) { return rval; }
+    rval = bvgraph_iterator_seek(&iter, start);
+    for (int64_t x = start; x < end && rval == 0; x++) {
+        if (x > start) {
+            rval = bvgraph_iterator_next(&iter);
+            if (rval) { break; }
+        }
+        visit(x, (const int64_t*)iter.window[x % iter.cyclic_buffer_size].a,
+            (uint64_t)iter.curr_outd);
+    }
+    bvgraph_iterator_free(&iter);
+    return (rval);
+}
+
+/** Call a functor with the successors of each node, decoded on a helper
+ * thread by a bvgraph_async_iterator.
+ *
+ * The functor runs over whole chunks, so decoding the next chunks 
+ * overlaps with the calls for the current one.
+ *
+ * @param[in] g the graph
+ * @param[in] depth the number of chunks the helper thread decodes ahead
+ * @param[in] visit a functor called as visit(x, links, d) for each node
+ * @return 0 on success
+ */
+template <class Visitor>
+int bvgraph_foreach_async(bvgraph *g, int depth, Visitor& visit)
+{
+    bvgraph_async_iterator iter;
+    int rval = bvgraph_async_nonzero_iterator(g, &iter, depth);
+    if (rval) { return rval; }
+    while (rval == 0 && bvgraph_async_iterator_valid(&iter)) {
+        const bvgraph_csr_chunk *c = iter.chunk;
+        for (int64_t k = iter.chunk_index; k < c->nodes; k++) {
+            visit(c->first + k, (const int64_t*)&c->links[c->rowstart[k]],
+                c->rowstart[k+1] - c->rowstart[k]);
+        }
+        rval = bvgraph_async_iterator_next_chunk(&iter);
+    }
+    bvgraph_async_iterator_free(&iter);
+    return (rval);
+}
+
+#endif /* LIBBVG_BVGRAPH_FOREACH_HPP */
@@ -0,0 +1,263 @@
+#ifndef DELTA_H
+#define DELTA_H
+
+const int DELTA[] = {
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+917631, 917631, 917631, 917631, 917632, 917632, 917632, 917632, 917633, 917633, 917633, 917633, 917634, 917634, 917634, 917634, 917635, 917635, 917635, 917635, 917636, 917636, 917636, 917636, 917637, 917637, 917637, 917637, 917638, 917638, 917638, 917638, 917639, 917639, 917639, 917639, 917640, 917640, 917640, 917640, 917641, 917641, 917641, 917641, 917642, 917642, 917642, 917642, 917643, 917643, 917643, 917643, 917644, 917644, 917644, 917644, 917645, 917645, 917645, 917645, 917646, 917646, 917646, 917646, 917647, 917647, 917647, 917647, 917648, 917648, 917648, 917648, 917649, 917649, 917649, 917649, 917650, 917650, 917650, 917650, 917651, 917651, 917651, 917651, 917652, 917652, 917652, 917652, 917653, 917653, 917653, 917653, 917654, 917654, 917654, 917654, 917655, 917655, 917655, 917655, 917656, 917656, 917656, 917656, 917657, 917657, 917657, 917657, 917658, 917658, 917658, 917658, 917659, 917659, 917659, 917659, 917660, 917660, 917660, 917660, 917661, 917661, 917661, 917661, 917662, 917662, 917662, 917662, 917663, 917663, 917663, 917663, 917664, 917664, 917664, 917664, 917665, 917665, 917665, 917665, 917666, 917666, 917666, 917666, 917667, 917667, 917667, 917667, 917668, 917668, 917668, 917668, 917669, 917669, 917669, 917669, 917670, 917670, 917670, 917670, 917671, 917671, 917671, 917671, 917672, 917672, 917672, 917672, 917673, 917673, 917673, 917673, 917674, 917674, 917674, 917674, 917675, 917675, 917675, 917675, 917676, 917676, 917676, 917676, 917677, 917677, 917677, 917677, 917678, 917678, 917678, 917678, 917679, 917679, 917679, 917679, 917680, 917680, 917680, 917680, 917681, 917681, 917681, 917681, 917682, 917682, 917682, 917682, 917683, 917683, 917683, 917683, 917684, 917684, 917684, 917684, 917685, 917685, 917685, 917685, 917686, 917686, 917686, 917686, 917687, 917687, 917687, 917687, 917688, 917688, 917688, 917688, 917689, 917689, 917689, 917689, 917690, 917690, 917690, 917690, 917691, 917691, 917691, 917691, 917692, 917692, 917692, 917692, 917693, 917693, 917693, 917693, 917694, 917694, 917694, 917694, 
+917695, 917695, 917695, 917695, 917696, 917696, 917696, 917696, 917697, 917697, 917697, 917697, 917698, 917698, 917698, 917698, 917699, 917699, 917699, 917699, 917700, 917700, 917700, 917700, 917701, 917701, 917701, 917701, 917702, 917702, 917702, 917702, 917703, 917703, 917703, 917703, 917704, 917704, 917704, 917704, 917705, 917705, 917705, 917705, 917706, 917706, 917706, 917706, 917707, 917707, 917707, 917707, 917708, 917708, 917708, 917708, 917709, 917709, 917709, 917709, 917710, 917710, 917710, 917710, 917711, 917711, 917711, 917711, 917712, 917712, 917712, 917712, 917713, 917713, 917713, 917713, 917714, 917714, 917714, 917714, 917715, 917715, 917715, 917715, 917716, 917716, 917716, 917716, 917717, 917717, 917717, 917717, 917718, 917718, 917718, 917718, 917719, 917719, 917719, 917719, 917720, 917720, 917720, 917720, 917721, 917721, 917721, 917721, 917722, 917722, 917722, 917722, 917723, 917723, 917723, 917723, 917724, 917724, 917724, 917724, 917725, 917725, 917725, 917725, 917726, 917726, 917726, 917726, 917727, 917727, 917727, 917727, 917728, 917728, 917728, 917728, 917729, 917729, 917729, 917729, 917730, 917730, 917730, 917730, 917731, 917731, 917731, 917731, 917732, 917732, 917732, 917732, 917733, 917733, 917733, 917733, 917734, 917734, 917734, 917734, 917735, 917735, 917735, 917735, 917736, 917736, 917736, 917736, 917737, 917737, 917737, 917737, 917738, 917738, 917738, 917738, 917739, 917739, 917739, 917739, 917740, 917740, 917740, 917740, 917741, 917741, 917741, 917741, 917742, 917742, 917742, 917742, 917743, 917743, 917743, 917743, 917744, 917744, 917744, 917744, 917745, 917745, 917745, 917745, 917746, 917746, 917746, 917746, 917747, 917747, 917747, 917747, 917748, 917748, 917748, 917748, 917749, 917749, 917749, 917749, 917750, 917750, 917750, 917750, 917751, 917751, 917751, 917751, 917752, 917752, 917752, 917752, 917753, 917753, 917753, 917753, 917754, 917754, 917754, 917754, 917755, 917755, 917755, 917755, 917756, 917756, 917756, 917756, 917757, 917757, 917757, 917757, 917758, 917758, 917758, 917758, 
+983295, 983295, 983296, 983296, 983297, 983297, 983298, 983298, 983299, 983299, 983300, 983300, 983301, 983301, 983302, 983302, 983303, 983303, 983304, 983304, 983305, 983305, 983306, 983306, 983307, 983307, 983308, 983308, 983309, 983309, 983310, 983310, 983311, 983311, 983312, 983312, 983313, 983313, 983314, 983314, 983315, 983315, 983316, 983316, 983317, 983317, 983318, 983318, 983319, 983319, 983320, 983320, 983321, 983321, 983322, 983322, 983323, 983323, 983324, 983324, 983325, 983325, 983326, 983326, 983327, 983327, 983328, 983328, 983329, 983329, 983330, 983330, 983331, 983331, 983332, 983332, 983333, 983333, 983334, 983334, 983335, 983335, 983336, 983336, 983337, 983337, 983338, 983338, 983339, 983339, 983340, 983340, 983341, 983341, 983342, 983342, 983343, 983343, 983344, 983344, 983345, 983345, 983346, 983346, 983347, 983347, 983348, 983348, 983349, 983349, 983350, 983350, 983351, 983351, 983352, 983352, 983353, 983353, 983354, 983354, 983355, 983355, 983356, 983356, 983357, 983357, 983358, 983358, 983359, 983359, 983360, 983360, 983361, 983361, 983362, 983362, 983363, 983363, 983364, 983364, 983365, 983365, 983366, 983366, 983367, 983367, 983368, 983368, 983369, 983369, 983370, 983370, 983371, 983371, 983372, 983372, 983373, 983373, 983374, 983374, 983375, 983375, 983376, 983376, 983377, 983377, 983378, 983378, 983379, 983379, 983380, 983380, 983381, 983381, 983382, 983382, 983383, 983383, 983384, 983384, 983385, 983385, 983386, 983386, 983387, 983387, 983388, 983388, 983389, 983389, 983390, 983390, 983391, 983391, 983392, 983392, 983393, 983393, 983394, 983394, 983395, 983395, 983396, 983396, 983397, 983397, 983398, 983398, 983399, 983399, 983400, 983400, 983401, 983401, 983402, 983402, 983403, 983403, 983404, 983404, 983405, 983405, 983406, 983406, 983407, 983407, 983408, 983408, 983409, 983409, 983410, 983410, 983411, 983411, 983412, 983412, 983413, 983413, 983414, 983414, 983415, 983415, 983416, 983416, 983417, 983417, 983418, 983418, 983419, 983419, 983420, 983420, 983421, 983421, 983422, 983422, 
+983423, 983423, 983424, 983424, 983425, 983425, 983426, 983426, 983427, 983427, 983428, 983428, 983429, 983429, 983430, 983430, 983431, 983431, 983432, 983432, 983433, 983433, 983434, 983434, 983435, 983435, 983436, 983436, 983437, 983437, 983438, 983438, 983439, 983439, 983440, 983440, 983441, 983441, 983442, 983442, 983443, 983443, 983444, 983444, 983445, 983445, 983446, 983446, 983447, 983447, 983448, 983448, 983449, 983449, 983450, 983450, 983451, 983451, 983452, 983452, 983453, 983453, 983454, 983454, 983455, 983455, 983456, 983456, 983457, 983457, 983458, 983458, 983459, 983459, 983460, 983460, 983461, 983461, 983462, 983462, 983463, 983463, 983464, 983464, 983465, 983465, 983466, 983466, 983467, 983467, 983468, 983468, 983469, 983469, 983470, 983470, 983471, 983471, 983472, 983472, 983473, 983473, 983474, 983474, 983475, 983475, 983476, 983476, 983477, 983477, 983478, 983478, 983479, 983479, 983480, 983480, 983481, 983481, 983482, 983482, 983483, 983483, 983484, 983484, 983485, 983485, 983486, 983486, 983487, 983487, 983488, 983488, 983489, 983489, 983490, 983490, 983491, 983491, 983492, 983492, 983493, 983493, 983494, 983494, 983495, 983495, 983496, 983496, 983497, 983497, 983498, 983498, 983499, 983499, 983500, 983500, 983501, 983501, 983502, 983502, 983503, 983503, 983504, 983504, 983505, 983505, 983506, 983506, 983507, 983507, 983508, 983508, 983509, 983509, 983510, 983510, 983511, 983511, 983512, 983512, 983513, 983513, 983514, 983514, 983515, 983515, 983516, 983516, 983517, 983517, 983518, 983518, 983519, 983519, 983520, 983520, 983521, 983521, 983522, 983522, 983523, 983523, 983524, 983524, 983525, 983525, 983526, 983526, 983527, 983527, 983528, 983528, 983529, 983529, 983530, 983530, 983531, 983531, 983532, 983532, 983533, 983533, 983534, 983534, 983535, 983535, 983536, 983536, 983537, 983537, 983538, 983538, 983539, 983539, 983540, 983540, 983541, 983541, 983542, 983542, 983543, 983543, 983544, 983544, 983545, 983545, 983546, 983546, 983547, 983547, 983548, 983548, 983549, 983549, 983550, 983550, 
+1049087, 1049088, 1049089, 1049090, 1049091, 1049092, 1049093, 1049094, 1049095, 1049096, 1049097, 1049098, 1049099, 1049100, 1049101, 1049102, 1049103, 1049104, 1049105, 1049106, 1049107, 1049108, 1049109, 1049110, 1049111, 1049112, 1049113, 1049114, 1049115, 1049116, 1049117, 1049118, 1049119, 1049120, 1049121, 1049122, 1049123, 1049124, 1049125, 1049126, 1049127, 1049128, 1049129, 1049130, 1049131, 1049132, 1049133, 1049134, 1049135, 1049136, 1049137, 1049138, 1049139, 1049140, 1049141, 1049142, 1049143, 1049144, 1049145, 1049146, 1049147, 1049148, 1049149, 1049150, 1049151, 1049152, 1049153, 1049154, 1049155, 1049156, 1049157, 1049158, 1049159, 1049160, 1049161, 1049162, 1049163, 1049164, 1049165, 1049166, 1049167, 1049168, 1049169, 1049170, 1049171, 1049172, 1049173, 1049174, 1049175, 1049176, 1049177, 1049178, 1049179, 1049180, 1049181, 1049182, 1049183, 1049184, 1049185, 1049186, 1049187, 1049188, 1049189, 1049190, 1049191, 1049192, 1049193, 1049194, 1049195, 1049196, 1049197, 1049198, 1049199, 1049200, 1049201, 1049202, 1049203, 1049204, 1049205, 1049206, 1049207, 1049208, 1049209, 1049210, 1049211, 1049212, 1049213, 1049214, 1049215, 1049216, 1049217, 1049218, 1049219, 1049220, 1049221, 1049222, 1049223, 1049224, 1049225, 1049226, 1049227, 1049228, 1049229, 1049230, 1049231, 1049232, 1049233, 1049234, 1049235, 1049236, 1049237, 1049238, 1049239, 1049240, 1049241, 1049242, 1049243, 1049244, 1049245, 1049246, 1049247, 1049248, 1049249, 1049250, 1049251, 1049252, 1049253, 1049254, 1049255, 1049256, 1049257, 1049258, 1049259, 1049260, 1049261, 1049262, 1049263, 1049264, 1049265, 1049266, 1049267, 1049268, 1049269, 1049270, 1049271, 1049272, 1049273, 1049274, 1049275, 1049276, 1049277, 1049278, 1049279, 1049280, 1049281, 1049282, 1049283, 1049284, 1049285, 1049286, 1049287, 1049288, 1049289, 1049290, 1049291, 1049292, 1049293, 1049294, 1049295, 1049296, 1049297, 1049298, 1049299, 1049300, 1049301, 1049302, 1049303, 1049304, 1049305, 1049306, 1049307, 1049308, 1049309, 1049310, 1049311, 1049312, 1049313, 1049314, 1049315, 1049316, 1049317, 1049318, 1049319, 1049320, 1049321, 1049322, 1049323, 1049324, 1049325, 1049326, 1049327, 1049328, 1049329, 1049330, 1049331, 1049332, 1049333, 1049334, 1049335, 1049336, 1049337, 1049338, 1049339, 1049340, 1049341, 1049342, 
+1049343, 1049344, 1049345, 1049346, 1049347, 1049348, 1049349, 1049350, 1049351, 1049352, 1049353, 1049354, 1049355, 1049356, 1049357, 1049358, 1049359, 1049360, 1049361, 1049362, 1049363, 1049364, 1049365, 1049366, 1049367, 1049368, 1049369, 1049370, 1049371, 1049372, 1049373, 1049374, 1049375, 1049376, 1049377, 1049378, 1049379, 1049380, 1049381, 1049382, 1049383, 1049384, 1049385, 1049386, 1049387, 1049388, 1049389, 1049390, 1049391, 1049392, 1049393, 1049394, 1049395, 1049396, 1049397, 1049398, 1049399, 1049400, 1049401, 1049402, 1049403, 1049404, 1049405, 1049406, 1049407, 1049408, 1049409, 1049410, 1049411, 1049412, 1049413, 1049414, 1049415, 1049416, 1049417, 1049418, 1049419, 1049420, 1049421, 1049422, 1049423, 1049424, 1049425, 1049426, 1049427, 1049428, 1049429, 1049430, 1049431, 1049432, 1049433, 1049434, 1049435, 1049436, 1049437, 1049438, 1049439, 1049440, 1049441, 1049442, 1049443, 1049444, 1049445, 1049446, 1049447, 1049448, 1049449, 1049450, 1049451, 1049452, 1049453, 1049454, 1049455, 1049456, 1049457, 1049458, 1049459, 1049460, 1049461, 1049462, 1049463, 1049464, 1049465, 1049466, 1049467, 1049468, 1049469, 1049470, 1049471, 1049472, 1049473, 1049474, 1049475, 1049476, 1049477, 1049478, 1049479, 1049480, 1049481, 1049482, 1049483, 1049484, 1049485, 1049486, 1049487, 1049488, 1049489, 1049490, 1049491, 1049492, 1049493, 1049494, 1049495, 1049496, 1049497, 1049498, 1049499, 1049500, 1049501, 1049502, 1049503, 1049504, 1049505, 1049506, 1049507, 1049508, 1049509, 1049510, 1049511, 1049512, 1049513, 1049514, 1049515, 1049516, 1049517, 1049518, 1049519, 1049520, 1049521, 1049522, 1049523, 1049524, 1049525, 1049526, 1049527, 1049528, 1049529, 1049530, 1049531, 1049532, 1049533, 1049534, 1049535, 1049536, 1049537, 1049538, 1049539, 1049540, 1049541, 1049542, 1049543, 1049544, 1049545, 1049546, 1049547, 1049548, 1049549, 1049550, 1049551, 1049552, 1049553, 1049554, 1049555, 1049556, 1049557, 1049558, 1049559, 1049560, 1049561, 1049562, 1049563, 1049564, 1049565, 1049566, 1049567, 1049568, 1049569, 1049570, 1049571, 1049572, 1049573, 1049574, 1049575, 1049576, 1049577, 1049578, 1049579, 1049580, 1049581, 1049582, 1049583, 1049584, 1049585, 1049586, 1049587, 1049588, 1049589, 1049590, 1049591, 1049592, 1049593, 1049594, 1049595, 1049596, 1049597, 1049598, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
+524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 524295, 
+524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 524296, 
+524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 524297, 
+524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 524298, 
+524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 524299, 
+524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 524300, 
+524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 524301, 
+524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 524302, 
+589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589839, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 589840, 
+589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589841, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 589842, 
+589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589843, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 589844, 
+589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589845, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 589846, 
+589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589847, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 589848, 
+589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589849, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 589850, 
+589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589851, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 589852, 
+589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589853, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 589854, 
+655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655391, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655392, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655393, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 655394, 
+655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655395, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655396, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655397, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 655398, 
+655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655399, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655400, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655401, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 655402, 
+655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655403, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655404, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655405, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 655406, 
+655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655407, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655408, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655409, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 655410, 
+655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655411, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655412, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655413, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 655414, 
+655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655415, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655416, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655417, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 655418, 
+655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655419, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655420, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655421, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 655422, 
+720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720959, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720960, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720961, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720962, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720963, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720964, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720965, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 720966, 
+720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720967, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720968, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720969, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720970, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720971, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720972, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720973, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 720974, 
+720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720975, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720976, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720977, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720978, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720979, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720980, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720981, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 720982, 
+720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720983, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720984, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720985, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720986, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720987, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720988, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720989, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 720990, 
+720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720991, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720992, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720993, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720994, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720995, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720996, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720997, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 720998, 
+720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 720999, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721000, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721001, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721002, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721003, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721004, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721005, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 721006, 
+721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721007, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721008, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721009, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721010, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721011, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721012, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721013, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 721014, 
+721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721015, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721016, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721017, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721018, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721019, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721020, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721021, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 721022, 
+262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 
+262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 
+262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 
+262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 
+262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 
+262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 
+262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 
+262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 
+262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 
+262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 
+262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 
+262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 
+262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 
+262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 
+262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 
+262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 262145, 
+262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 
+262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 
+262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 
+262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 
+262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 
+262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 
+262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 
+262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 
+262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 
+262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 
+262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 
+262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 
+262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 
+262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 
+262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 
+262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 262146, 
+327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 
+327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 
+327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 
+327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 
+327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 
+327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 
+327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 
+327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 327683, 
+327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 
+327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 
+327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 
+327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 
+327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 
+327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 
+327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 
+327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 327684, 
+327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 
+327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 
+327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 
+327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 
+327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 
+327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 
+327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 
+327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 327685, 
+327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 
+327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 
+327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 
+327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 
+327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 
+327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 
+327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 
+327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 327686, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 
+65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536, 65536
+};
+
+#endif
@@ -62,6 +62,8 @@ int eflist_add(elias_fano_list *ef, int64_t elem);
 int eflist_addbatch(elias_fano_list *ef, int64_t *arr, int64_t length);
 int64_t eflist_get(elias_fano_list *ef, int64_t index);
 int eflist_free(elias_fano_list *ef);
+int eflist_save(elias_fano_list *ef, FILE *f);
+int eflist_load(elias_fano_list *ef, FILE *f);
 size_t eflist_size(uint64_t num_elements, uint64_t largest, int spill_factor);
 int64_t bit_search(void *mem, int64_t start_bit_offset, size_t l);
     
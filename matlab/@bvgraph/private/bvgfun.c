@@ -340,7 +340,7 @@ void load_bvgraph(int nlhs, mxArray* plhs[], int nrhs, const mxArray* prhs[])
         
         rval = bvgraph_load_external(&g, filename, filenamelen, offset_step,
             mxGetData(gmem), mxGetNumberOfElements(gmem),
-            mxGetData(offsetmem), mxGetNumberOfElements(offsetmem));
+            mxGetData(offsetmem), mxGetNumberOfElements(offsetmem), 0);
         if (rval != 0) {
             mexErrMsgIdAndTxt("bvgfun:error",
                 "libbvg reported error (final load): %s", bvgraph_error_string(rval));
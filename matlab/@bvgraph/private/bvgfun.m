@@ -29,6 +29,12 @@ function varargout = bvgfun(varargin)
 % 4 September 2007
 % Changed compile script to work on Matlab 7.0
 
+% 17 October 2026
+% Compile eflist.c for the Elias-Fano offsets
+% Compile bvgraph_outdegree.c for the outdegree scans
+% Compile bvgraph_checkpoint.c for the iterator checkpoints
+% Compile bvgraph_shared_cache.c for the shared successor cache
+
 
 % actually, all this function does is compile the mex file and then
 % redirect the original call
@@ -50,7 +56,7 @@ if isunix
 end
     
 
-srcfiles = {'bitfile.c', 'bvgraph.c', 'bvgraph_iterator.c', 'bvgraph_random.c','bvgraphfun.c', 'properties.c', 'util.c'};
+srcfiles = {'bitfile.c', 'bvgraph.c', 'bvgraph_iterator.c', 'bvgraph_random.c','bvgraphfun.c', 'properties.c', 'util.c', 'eflist.c', 'bvgraph_outdegree.c', 'bvgraph_checkpoint.c', 'bvgraph_shared_cache.c'};
 files{1} = 'bvgfun.c';
 for sfi=1:length(srcfiles)
     files{end+1} = sprintf('%s/%s',srcdir,srcfiles{sfi});
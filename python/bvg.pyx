@@ -246,28 +246,23 @@ cdef class BVGraph:
         if self.offset_step < 0:
             raise TypeError()
  
-        # declare and initialize a new iterator
-        cdef clibbvg.bvgraph_iterator nit
-        rval = clibbvg.bvgraph_nonzero_iterator(self.g, &nit)
+        # declare and initialize a new iterator, which reads the
+        # outdegrees without decoding the successors
+        cdef clibbvg.bvgraph_outdegree_iterator nit
+        rval = clibbvg.bvgraph_outdegree_range_iterator(self.g, 0, self.g.n, &nit)
         if rval != 0:
             raise MemoryError()
-        
-        cdef int64_t* links
-        cdef uint64_t d
 
-        while clibbvg.bvgraph_iterator_valid(&nit):
-            # get successors and degree
-            clibbvg.bvgraph_iterator_outedges(&nit, &links, &d)
-            
+        while clibbvg.bvgraph_outdegree_iterator_valid(&nit):
             node = long(nit.curr)
-            degree = long(d)
+            degree = long(nit.curr_outd)
             yield (node, degree)
 
             # iterate to next vertex
-            clibbvg.bvgraph_iterator_next(&nit)
+            clibbvg.bvgraph_outdegree_iterator_next(&nit)
 
         # free iterator object
-        clibbvg.bvgraph_iterator_free(&nit)
+        clibbvg.bvgraph_outdegree_iterator_free(&nit)
 
     def out_degree_iter(self):
         """Return an iterator for (node, degree).
@@ -10,6 +10,10 @@ cdef extern from "../include/bvgraph.h":
         pass
     ctypedef struct bvgraph_random_iterator:
         pass
+    ctypedef struct bvgraph_outdegree_iterator:
+        int64_t curr
+        int64_t curr_outd
+        pass
 
     # initiailize functions
     bvgraph* bvgraph_new()
@@ -28,6 +32,14 @@ cdef extern from "../include/bvgraph.h":
     int bvgraph_iterator_outedges(bvgraph_iterator* i, int64_t** start, uint64_t* length)
     int bvgraph_iterator_free(bvgraph_iterator *i)
 
+    # for outdegrees
+    int bvgraph_outdegree_range_iterator(bvgraph *g, int64_t start, int64_t end, bvgraph_outdegree_iterator *i)
+    int bvgraph_outdegree_iterator_next(bvgraph_outdegree_iterator *i)
+    int bvgraph_outdegree_iterator_valid(bvgraph_outdegree_iterator *i)
+    int bvgraph_outdegree_iterator_free(bvgraph_outdegree_iterator *i)
+    int bvgraph_outdegrees(bvgraph *g, int64_t *out)
+    int bvgraph_cache_outdegrees(bvgraph *g)
+
     int bvgraph_outdegree(bvgraph *g, int64_t x, uint64_t *d)
     int bvgraph_successors(bvgraph *g, int64_t x, int64_t** start, uint64_t *length)
 
@@ -10,6 +10,12 @@ setup(
              "src/bitfile.c",
              "src/bvgraph.c",
              "src/bvgraph_iterator.c",
-             "src/bvgraph_random.c"],
+             "src/bvgraph_random.c",
+             "src/properties.c",
+             "src/util.c",
+             "src/eflist.c",
+             "src/bvgraph_outdegree.c",
+             "src/bvgraph_checkpoint.c",
+             "src/bvgraph_shared_cache.c"],
              include_dirs=["include"])]
 )
@@ -19,6 +19,16 @@
  *             Added bitfile_skip_gammas and bitfile_skip_deltas
  *             Added bitfile_position
  *             Added bitfile_skip
+ * 2026-10-17: Added refill64 to load the bit buffer a 64-bit word at a
+ *             time and widened read_from_current to 64-bits
+ *             Rewrote bitfile_read_unary to count leading zeros over the
+ *             64-bit buffer
+ *             Added bitfile_read_delta and the DELTA table for
+ *             bitfile_skip_deltas
+ *             Added lazily built zeta tables for k = 1..7
+ *             Added bitfile_read_golomb and bitfile_read_skewed_golomb
+ *             bitfile_position updates the bits read for bitfile_tell
+ *             Fixed the skewed Golomb split point to match dsiutils
  */
 
 #include <stdlib.h>
@@ -29,8 +39,13 @@
 
 #include <assert.h>
 #include "gamma.h"
+#include "delta.h"
 #include "zeta.h"
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 /**
  * Allocate a few lookup tables to speed the computations
  */
@@ -72,6 +87,33 @@ const int BYTEMSB[] = {
         7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7
 }; ///< the position of the most significant bit of 1
 
+/** Count the number of leading zero bits in a 64-bit word
+ *
+ * @param[in] x a non-zero word
+ * @return the number of zero bits before the most significant 1
+ */
+static inline int clz64(uint64_t x)
+{
+    assert( x != 0 );
+#if defined(__GNUC__)
+    return __builtin_clzll(x);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    {
+        unsigned long i;
+        _BitScanReverse64(&i, x);
+        return 63 - (int)i;
+    }
+#else
+    {
+        int n = 0;
+        if ((x & UINT64_C(0xFFFFFFFF00000000)) == 0) { n += 32; x <<= 32; }
+        if ((x & UINT64_C(0xFFFF000000000000)) == 0) { n += 16; x <<= 16; }
+        if ((x & UINT64_C(0xFF00000000000000)) == 0) { n += 8; x <<= 8; }
+        return n + 7 - BYTEMSB[x >> 56];
+    }
+#endif
+}
+
 // pre-computed table for gamma encoding
 //int GAMMA[256*256];
 
@@ -261,11 +303,64 @@ static int bitfile_read(bitfile* bf)
 }
 
 
+/** Load 8 bytes as a big-endian 64-bit word
+ *
+ * The load does not need to be aligned.
+ *
+ * @param[in] p a pointer to 8 readable bytes
+ * @return the bytes p[0], ..., p[7] with p[0] in the most significant byte
+ */
+static inline uint64_t load_be64(const unsigned char *p)
+{
+    uint64_t w;
+    memcpy(&w, p, sizeof(w));
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && \
+    __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    w = __builtin_bswap64(w);
+#elif defined(__GNUC__) && defined(__BYTE_ORDER__) && \
+    __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    // already in the right order
+#elif defined(_MSC_VER)
+    w = _byteswap_uint64(w);
+#else
+    w = ((uint64_t)p[0] << 56) | ((uint64_t)p[1] << 48) | 
+        ((uint64_t)p[2] << 40) | ((uint64_t)p[3] << 32) |
+        ((uint64_t)p[4] << 24) | ((uint64_t)p[5] << 16) | 
+        ((uint64_t)p[6] << 8)  | ((uint64_t)p[7]);
+#endif
+    return w;
+}
+
+/** Fills the bit-buffer with as many whole bytes as fit in 63-bits
+ *
+ * This method requires that bf->avail >= 8 so that an entire 64-bit word
+ * can be loaded from the byte buffer.  It moves the largest number of 
+ * whole bytes that fit into bf->current, which leaves at least 56 bits 
+ * in the buffer.
+ * 
+ * @param[in] bf the bitfile
+ * @return the current value of fill.
+ */
+static inline int refill64(bitfile *bf) {
+    const int nbytes = (63 - (int)bf->fill) >> 3;
+    assert( bf->avail >= 8 );
+    if (nbytes > 0) {
+        const int nbits = nbytes << 3;
+        const uint64_t w = load_be64(bf->buffer + bf->pos);
+        bf->current = (bf->current << nbits) | (w >> (64 - nbits));
+        bf->pos += nbytes;
+        bf->avail -= nbytes;
+        bf->fill += nbits;
+    }
+    return (int)bf->fill;
+}
+
 /** Fills the bit-buffer to at least 16-bits
  *
  * This method will ensure that bf->current has 16-bits of data,
  * *if possible* given the current state of the file.  It will
- * return the size of the fill
+ * return the size of the fill.  When there are at least 8 bytes
+ * left in the byte buffer, it will load an entire word instead.
  * 
  * @param[in] bf the bitfile
  * @return the current value of fill.
@@ -274,7 +369,9 @@ static int bitfile_read(bitfile* bf)
 // TODO, check the logistics of this with the bvgraph codes
 static int refill16(bitfile *bf) {
     if (bf->fill < 16) { // make sure there is work to do
-        if (bf->avail >= 2) {
+        if (bf->avail >= 8) {
+            return refill64(bf);
+        } else if (bf->avail >= 2) {
             bf->current = (bf->current << 8) | (bf->buffer[bf->pos++] & 0xFF);
             bf->current = (bf->current << 8) | (bf->buffer[bf->pos++] & 0xFF);
             bf->avail -= 2;
@@ -394,6 +491,7 @@ int bitfile_position(bitfile* bf, const long long position)
         // in this case, we have all the data loaded into the current byte
         // so we will just update our position in the byte.
         bf->fill = (int)bit_delta;
+        bf->total_bits_read = position;
         return (0);
     } else {
         // position the byte
@@ -417,6 +515,7 @@ int bitfile_position(bitfile* bf, const long long position)
             bf->current = bitfile_read(bf);
             bf->fill = 8 - residual;
         }
+        bf->total_bits_read = position;
 
         return (0);
     }
@@ -565,15 +664,14 @@ int bitfile_skip_gammas(bitfile* bf, int n)
  */
 int bitfile_skip_deltas(bitfile* bf, int n)
 {
-    //int pre_comp;
+    int pre_comp;
     while (n-- != 0) {
-        // don't use precomputed tables for now
-        //if ((bf->fill >= 16 || refill(bf) >= 16) && 
-        //    (pre_comp = DELTA[bf->current>>(bf->fill-16)&0xFFFF]>>16) != 0) {
-        //    bf->total_bits_read += pre_comp;
-        //    bf->fill -= pre_comp;
-        //    continue;
-        //}
+        if ((bf->fill >= 16 || refill16(bf) >= 16) && 
+            (pre_comp = DELTA[bf->current>>(bf->fill-16)&0xFFFF]>>16) != 0) {
+            bf->total_bits_read += pre_comp;
+            bf->fill -= pre_comp;
+            continue;
+        }
         bitfile_skip(bf, (long long)bitfile_read_gamma(bf));
     }
 
@@ -584,17 +682,16 @@ int bitfile_skip_deltas(bitfile* bf, int n)
 /**
  * Read bits from the buffer, possibly refilling it.
  */
-static int read_from_current(bitfile *bf, const size_t len)
+static uint64_t read_from_current(bitfile *bf, const size_t len)
 {
-    unsigned int rval;
     if (len == 0) { return 0; }
     if (bf->fill == 0) {  
         bf->current = bitfile_read(bf); 
         bf->fill = 8; 
     }
     bf->total_bits_read += len;
-    rval = (unsigned)bf->current;
-    return (rval >> ( bf->fill -= len) & ((1 << len) - 1));
+    bf->fill -= len;
+    return (bf->current >> bf->fill) & ((UINT64_C(1) << len) - 1);
 }
             
 /**
@@ -618,8 +715,10 @@ int64_t bitfile_read_int(bitfile* bf, unsigned int len)
     int i;
     int64_t x = 0;
     assert ( len <= 64 );
-    if (bf->fill < 16) { refill16(bf); }
-    //printf("bf->fill: %d\n", bf->fill);
+    if (bf->fill < len) {
+        if (bf->avail >= 8) { refill64(bf); } 
+        else { refill16(bf); }
+    }
 
     if (len <= bf->fill) {
         return read_from_current(bf, len);
@@ -644,37 +743,27 @@ int64_t bitfile_read_int(bitfile* bf, unsigned int len)
  */
 int bitfile_read_unary(bitfile* bf)
 {
-    int x;
-    unsigned int current_left_aligned;
-    assert ( bf->fill < 32 );
-    if (bf->fill < 16) {
-        //printf("refill [%d]\n", (int)bf->fill);
-        refill16(bf);
-        //printf("done [%d]\n", (int)bf->fill);
-    }
-
-    current_left_aligned = (unsigned int)(bf->current << (32 - bf->fill) & 0xFFFFFFFF);
+    int x = 0;
+    for (;;) {
+        uint64_t current_left_aligned;
+        if (bf->fill < 16 && refill16(bf) == 0) { 
+            break; // out of data
+        }
 
+        current_left_aligned = bf->current << (64 - bf->fill);
+        if (current_left_aligned != 0) {
+            const int y = clz64(current_left_aligned);
+            bf->total_bits_read += y + 1;
+            bf->fill -= y + 1;
+            return (x + y);
+        }
 
-    if (current_left_aligned != 0)
-    {
-        if ((current_left_aligned & 0xFF000000) != 0)
-            { x = 7 - BYTEMSB[current_left_aligned >> 24]; }
-        else if ((current_left_aligned & 0xFF0000) != 0) 
-            { x = 15 - BYTEMSB[current_left_aligned >> 16]; }
-        else if ((current_left_aligned & 0xFF00) != 0) 
-            { x = 23 - BYTEMSB[current_left_aligned >> 8]; }
-        else 
-            { x = 31 - BYTEMSB[current_left_aligned & 0xFF]; }
-        bf->total_bits_read += x + 1;
-        bf->fill -= x + 1;
-        return (x);
+        // all of the buffered bits are zero, so consume them and 
+        // continue with the next word
+        x += (int)bf->fill;
+        bf->total_bits_read += bf->fill;
+        bf->fill = 0;
     }
-    
-    x = (int)bf->fill;
-    while ( (bf->current = bitfile_read(bf)) == 0) { x += 8; }
-    x += 7 - (int)( bf->fill = BYTEMSB[bf->current] );
-    bf->total_bits_read += x + 1;
     return (x);
 }
 
@@ -696,17 +785,122 @@ int64_t bitfile_read_gamma(bitfile* bf)
         return ( ( 1ULL << msb ) | bitfile_read_int(bf, msb) ) - 1;
     }
 }
+/**
+ * Read a delta coded integer.
+ * @param[in] bf the bitfile
+ * @return the value of the delta coded integer
+ */
+int64_t bitfile_read_delta(bitfile* bf)
+{
+    int precomp;
+    if ( ( bf->fill >= 16 || refill16(bf) >= 16 ) &&
+         ( (precomp = DELTA[ bf->current >> ( bf->fill - 16 ) & 0xFFFF ]) != 0 ) ) {
+        bf->total_bits_read += precomp >> 16;
+        bf->fill -= precomp >> 16;
+        return (int64_t)( precomp & 0xFFFF );
+    } else {
+        const int msb = (int)bitfile_read_gamma(bf);
+        return ( ( 1ULL << msb ) | bitfile_read_int(bf, msb) ) - 1;
+    }
+}
+
+/**
+ * Lookup tables for zeta_k codes, indexed by k.  The table for k = 3
+ * is the precomputed ZETA table, the others are built on demand by
+ * bitfile_zeta_table.  A NULL entry sends bitfile_read_zeta down the
+ * slow path.
+ */
+static const int* zeta_tables[BITFILE_MAX_ZETA_TABLE_K+1] = {
+    NULL, NULL, NULL, ZETA, NULL, NULL, NULL, NULL };
+
+/**
+ * Install a freshly built lookup table in its slot unless another 
+ * thread already did.
+ * @param[in,out] slot the table slot
+ * @param[in] table the new table, freed if it loses
+ * @return the table in the slot
+ */
+static const int* publish_table(const int **slot, int *table)
+{
+#if defined(__GNUC__)
+    if (!__sync_bool_compare_and_swap(slot, NULL, table)) {
+        free(table); // another thread won
+    }
+#else
+    *slot = table;
+#endif
+    return *slot;
+}
+
+/**
+ * Fill a 16-bit lookup table for a zeta_k code.  Each entry is
+ * (length << 16) | value for the code starting at the high bit of the
+ * index, or 0 if that code is longer than 16 bits.
+ * @param[in] k the zeta shrinking factor
+ * @param[out] table an array of 65536 entries
+ */
+static void build_zeta_table(const int k, int *table)
+{
+    int w;
+    for (w = 0; w < 65536; w++) {
+        int h = 0, len, width;
+        uint64_t left, m, value;
+        table[w] = 0;
+        while (h < 16 && !(w & (0x8000 >> h))) { h++; }
+        width = h*k + k - 1;
+        len = h + 1 + width;
+        if (len > 16) { continue; }
+        left = UINT64_C(1) << (h*k);
+        m = ((unsigned)w >> (16 - len)) & ((UINT64_C(1) << width) - 1);
+        if (m < left) {
+            value = m + left - 1;
+        } else {
+            if (++len > 16) { continue; }
+            value = (m << 1) + (((unsigned)w >> (16 - len)) & 1) - 1;
+        }
+        if (value > 0xFFFF) { continue; }
+        table[w] = (len << 16) | (int)value;
+    }
+}
+
+/**
+ * Get the lookup table for zeta_k codes, building it on first use.
+ * 
+ * Call this once before decoding (bvgraph_load does) so that
+ * bitfile_read_zeta uses the table; it is safe to call from several
+ * threads.
+ * 
+ * @param[in] k the zeta shrinking factor
+ * @return the table or NULL if k is out of range or memory ran out
+ */
+const int* bitfile_zeta_table(const int k)
+{
+    int *table;
+    if (k < 1 || k > BITFILE_MAX_ZETA_TABLE_K) { return NULL; }
+    if (zeta_tables[k] != NULL) { return zeta_tables[k]; }
+
+    table = malloc(sizeof(int)*65536);
+    if (!table) { return NULL; }
+    build_zeta_table(k, table);
+    return publish_table(&zeta_tables[k], table);
+}
+
 /**
  * Read a zeta coded integer.
+ * 
+ * This function is table driven when the table for k has been built
+ * with bitfile_zeta_table.
+ * 
  * @param[in] bf the bitfile
- * @param[in] k the parameter k in the gamma code.
+ * @param[in] k the zeta shrinking factor
  * @return the value of the zeta(k) coded integer.
  */
 int64_t bitfile_read_zeta(bitfile* bf, const int k)
 {
     int precomp;
-    if ( k == 3 && ( bf->fill >= 16 || refill16(bf) >= 16 ) &&
-            ( precomp = ZETA[ bf->current >> ( bf->fill - 16 ) & 0xFFFF ] ) != 0 ) {
+    const int *table = (unsigned)k <= BITFILE_MAX_ZETA_TABLE_K ? zeta_tables[k] : NULL;
+    if ( table && ( bf->fill >= 16 || refill16(bf) >= 16 ) &&
+            ( precomp = table[ bf->current >> ( bf->fill - 16 ) & 0xFFFF ] ) != 0 ) {
         bf->total_bits_read += precomp >> 16;
         bf->fill -= precomp >> 16;
         return (int64_t)( precomp & 0xFFFF );
@@ -722,6 +916,186 @@ int64_t bitfile_read_zeta(bitfile* bf, const int k)
     }
 }
 
+/**
+ * Lookup tables for Golomb and skewed Golomb codes, indexed by b and
+ * built on demand by bitfile_golomb_table and 
+ * bitfile_skewed_golomb_table.
+ */
+static const int* golomb_tables[BITFILE_MAX_GOLOMB_TABLE_B+1];
+static const int* skewed_golomb_tables[BITFILE_MAX_GOLOMB_TABLE_B+1];
+
+/**
+ * Read len bits from the high end of a 16-bit word while building a 
+ * table.
+ * @param[in] w the 16-bit word
+ * @param[in,out] used the number of bits of w already consumed
+ * @param[in] len the number of bits
+ * @return the bits or -1 if they run past the end of w
+ */
+static int64_t table_read_int(const unsigned w, int *used, const int len)
+{
+    if (*used + len > 16) { return -1; }
+    *used += len;
+    return (w >> (16 - *used)) & ((1u << len) - 1);
+}
+
+static int64_t table_read_unary(const unsigned w, int *used)
+{
+    int x = 0;
+    while (*used < 16 && !(w & (0x8000 >> *used))) { (*used)++; x++; }
+    if (*used == 16) { return -1; }
+    (*used)++;
+    return x;
+}
+
+/** Minimal binary code in [0,z) using the high bits of a 16-bit word */
+static int64_t table_read_minimal_binary(const unsigned w, int *used, 
+                                         const uint64_t z)
+{
+    const int log2z = 63 - clz64(z);
+    const int64_t m = (INT64_C(2) << log2z) - (int64_t)z;
+    int64_t x = table_read_int(w, used, log2z), bit;
+    if (x < 0 || x < m) { return x; }
+    if ((bit = table_read_int(w, used, 1)) < 0) { return -1; }
+    return ((x << 1) + bit) - m;
+}
+
+/**
+ * Fill a 16-bit lookup table for a Golomb or skewed Golomb code with 
+ * the same layout as the zeta tables.
+ * @param[in] b the Golomb modulus
+ * @param[in] skewed true for the skewed Golomb code
+ * @param[out] table an array of 65536 entries
+ */
+static void build_golomb_table(const int b, const int skewed, int *table)
+{
+    unsigned w;
+    for (w = 0; w < 65536; w++) {
+        int used = 0;
+        int64_t q = table_read_unary(w, &used), value = -1;
+        table[w] = 0;
+        if (q < 0) { continue; }
+        if (!skewed) {
+            value = table_read_minimal_binary(w, &used, b);
+            if (value >= 0) { value += q*b; }
+        } else {
+            const uint64_t M = ((UINT64_C(2) << q) - 1)*b;
+            const uint64_t m = (M / (2*b))*b;
+            value = table_read_minimal_binary(w, &used, M - m);
+            if (value >= 0) { value += m; }
+        }
+        if (value < 0 || value > 0xFFFF) { continue; }
+        table[w] = (used << 16) | (int)value;
+    }
+}
+
+/**
+ * Get the lookup table for Golomb codes with modulus b, building it
+ * on first use.
+ * @param[in] b the Golomb modulus
+ * @return the table or NULL if b is out of range or memory ran out
+ */
+const int* bitfile_golomb_table(const int b)
+{
+    int *table;
+    if (b < 1 || b > BITFILE_MAX_GOLOMB_TABLE_B) { return NULL; }
+    if (golomb_tables[b] != NULL) { return golomb_tables[b]; }
+
+    table = malloc(sizeof(int)*65536);
+    if (!table) { return NULL; }
+    build_golomb_table(b, 0, table);
+    return publish_table(&golomb_tables[b], table);
+}
+
+/**
+ * Get the lookup table for skewed Golomb codes with modulus b, 
+ * building it on first use.
+ * @param[in] b the Golomb modulus
+ * @return the table or NULL if b is out of range or memory ran out
+ */
+const int* bitfile_skewed_golomb_table(const int b)
+{
+    int *table;
+    if (b < 1 || b > BITFILE_MAX_GOLOMB_TABLE_B) { return NULL; }
+    if (skewed_golomb_tables[b] != NULL) { return skewed_golomb_tables[b]; }
+
+    table = malloc(sizeof(int)*65536);
+    if (!table) { return NULL; }
+    build_golomb_table(b, 1, table);
+    return publish_table(&skewed_golomb_tables[b], table);
+}
+
+/**
+ * Read a minimal binary coded integer in the range [0,z).
+ * @param[in] bf the bitfile
+ * @param[in] z the bound, z >= 1
+ * @return the value
+ */
+static inline int64_t read_minimal_binary(bitfile* bf, const uint64_t z)
+{
+    const int log2z = 63 - clz64(z);
+    const int64_t m = (INT64_C(2) << log2z) - (int64_t)z;
+    const int64_t x = bitfile_read_int(bf, log2z);
+    if (x < m) { return x; }
+    return ((x << 1) + bitfile_read_bit(bf)) - m;
+}
+
+/**
+ * Read a Golomb coded integer.
+ * 
+ * This function is table driven when the table for b has been built
+ * with bitfile_golomb_table.
+ * 
+ * @param[in] bf the bitfile
+ * @param[in] b the Golomb modulus
+ * @return the value of the Golomb coded integer
+ */
+int64_t bitfile_read_golomb(bitfile* bf, const int b)
+{
+    int precomp;
+    const int *table = (unsigned)b <= BITFILE_MAX_GOLOMB_TABLE_B ? golomb_tables[b] : NULL;
+    if ( table && ( bf->fill >= 16 || refill16(bf) >= 16 ) &&
+            ( precomp = table[ bf->current >> ( bf->fill - 16 ) & 0xFFFF ] ) != 0 ) {
+        bf->total_bits_read += precomp >> 16;
+        bf->fill -= precomp >> 16;
+        return (int64_t)( precomp & 0xFFFF );
+    } else if (b < 1) {
+        return 0; // a zero modulus codes only zeros, in zero bits
+    } else {
+        const int64_t q = bitfile_read_unary(bf);
+        return q*b + read_minimal_binary(bf, b);
+    }
+}
+
+/**
+ * Read a skewed Golomb coded integer.
+ * 
+ * This function is table driven when the table for b has been built
+ * with bitfile_skewed_golomb_table.
+ * 
+ * @param[in] bf the bitfile
+ * @param[in] b the Golomb modulus
+ * @return the value of the skewed Golomb coded integer
+ */
+int64_t bitfile_read_skewed_golomb(bitfile* bf, const int b)
+{
+    int precomp;
+    const int *table = (unsigned)b <= BITFILE_MAX_GOLOMB_TABLE_B ? skewed_golomb_tables[b] : NULL;
+    if ( table && ( bf->fill >= 16 || refill16(bf) >= 16 ) &&
+            ( precomp = table[ bf->current >> ( bf->fill - 16 ) & 0xFFFF ] ) != 0 ) {
+        bf->total_bits_read += precomp >> 16;
+        bf->fill -= precomp >> 16;
+        return (int64_t)( precomp & 0xFFFF );
+    } else if (b < 1) {
+        return 0;
+    } else {
+        const int u = bitfile_read_unary(bf);
+        const uint64_t M = ((UINT64_C(2) << u) - 1)*(uint64_t)b;
+        const uint64_t m = (M / (2*(uint64_t)b))*b;
+        return (int64_t)m + read_minimal_binary(bf, M - m);
+    }
+}
+
 /**
  * Read a nibbled coded integer.
  * @param[in] bf the bitfile
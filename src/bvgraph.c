@@ -15,6 +15,24 @@
  *
  *  01-24-2008: Added function to initialize structure memory to fix a 
  *              segfault on the 32-bit version.
+ *  10-17-2026: Select the zeta_k lookup table at load time.
+ *              Build the Golomb lookup tables at load time.
+ *              Added bvgraph_load_mmap.
+ *              Added flags to bvgraph_load_external for memory mapped,
+ *              huge page and pre-faulted graphs.
+ *              Added Elias-Fano offsets.
+ *              Support offset_step > 1 by sampling the offsets.
+ *              Save rebuilt offsets to .offsets or .ef files and load
+ *              offsets from a .ef file.
+ *              Build offsets by skipping successor lists instead of 
+ *              decoding them with an iterator.
+ *              Release the outdegree cache in bvgraph_close and read it
+ *              in bvgraph_outdegree.
+ *              Release the iterator checkpoints in bvgraph_close.
+ *              Release the shared successor cache in bvgraph_close.
+ *              Added bvgraph_call_buffer_too_small.
+ *              Check the offsets allocation and release the graph memory
+ *              when it fails.
  */
 
 #include "bvgraph_internal.h"
@@ -27,6 +45,7 @@
 const int bvgraph_call_out_of_memory = -1;          ///< error code for call out of memory
 const int bvgraph_call_io_error = -2;               ///< error code for io error
 const int bvgraph_call_unsupported = -3;            ///< error code for unsupported call
+const int bvgraph_call_buffer_too_small = -4;       ///< error code for an output buffer too small
 const int bvgraph_load_error_filename_too_long = 11;///< error code for file name too long
 const int bvgraph_load_error_buffer_too_small = 12; ///< error code for buffer too small
 const int bvgraph_property_file_error = 21;         ///< error code for property file 
@@ -48,6 +67,273 @@ static void set_defaults(bvgraph *g)
     g->max_ref_count = 3;
 }
 
+/**
+ * Build the lookup tables for a Golomb coded component.
+ * @param[in] coding the coding of the component
+ * @param[in] b the Golomb modulus of the component
+ */
+
+static void select_golomb_table(enum bvgraph_compression_flag_tag coding, int b)
+{
+    if (coding == BVGRAPH_FLAG_GOLOMB) { bitfile_golomb_table(b); }
+    else if (coding == BVGRAPH_FLAG_SKEWED_GOLOMB) { bitfile_skewed_golomb_table(b); }
+}
+
+/**
+ * Build the lookup tables for the parametrized codes of a graph, so
+ * the bitfile decoders are table driven.  Codes without a table
+ * (e.g. zeta_k with large k) still decode, only more slowly.
+ * @param[in] g the graph
+ */
+
+static void select_code_tables(bvgraph *g)
+{
+    if (g->residual_coding == BVGRAPH_FLAG_ZETA) { bitfile_zeta_table(g->zeta_k); }
+    select_golomb_table(g->outdegree_coding, g->outdegree_golomb_b);
+    select_golomb_table(g->block_coding, g->block_golomb_b);
+    select_golomb_table(g->residual_coding, g->residual_golomb_b);
+    select_golomb_table(g->reference_coding, g->reference_golomb_b);
+    select_golomb_table(g->block_count_coding, g->block_count_golomb_b);
+    select_golomb_table(g->offset_coding, g->offset_golomb_b);
+}
+
+/**
+ * The number of offsets stored for a graph, one for every 
+ * offset_step-th node.
+ * @param[in] n the number of nodes
+ * @param[in] offset_step the offset step, at least 1
+ */
+
+static int64_t sampled_offsets(int64_t n, int offset_step)
+{
+    return (n + offset_step - 1)/offset_step;
+}
+
+/**
+ * Release the graph memory of a partly loaded graph, as bvgraph_close
+ * does, after a later step of the load failed.
+ * @param[in] g the graph
+ */
+
+static void release_memory(bvgraph *g)
+{
+    if (g->memory_mapped) { funmap(g->memory, g->memory_size); }
+    else if (!g->memory_external) { free(g->memory); }
+    g->memory = NULL;
+    g->memory_size = 0;
+    g->memory_mapped = 0;
+}
+
+/**
+ * Save the offset of node i while loading a graph.  Offsets must be
+ * stored in order of i, which is how an Elias-Fano list is built.
+ * Only the offsets of every offset_step-th node are kept.
+ * @param[in] g the graph
+ * @param[in] i the node
+ * @param[in] off the bit offset of node i in the graph file
+ */
+
+static void store_offset(bvgraph *g, int64_t i, unsigned long long off)
+{
+    if (g->offset_step > 1) {
+        if (i % g->offset_step != 0) { return; }
+        i /= g->offset_step;
+    }
+    if (g->offsets_ef) {
+        assert((uint64_t)i == g->ef_offsets.curr);
+        eflist_add(&g->ef_offsets, (int64_t)off);
+    } else {
+        g->offsets[i] = off;
+    }
+}
+
+/**
+ * A bit writer for saving gamma coded offsets to a temporary file,
+ * which is renamed over the .offsets file when it is complete.
+ */
+
+typedef struct offsets_writer_tag {
+    FILE *f;
+    char *tmpname;
+    uint64_t buffer; ///< the bits not written yet, in the low bits
+    int fill;        ///< the number of bits in the buffer
+} offsets_writer;
+
+/**
+ * Write the low len bits of x, most significant bit first.
+ */
+
+static void write_bits(offsets_writer *w, uint64_t x, int len)
+{
+    while (len > 0) {
+        int k = len > 32 ? 32 : len;
+        len -= k;
+        w->buffer = (w->buffer << k) | ((x >> len) & ((UINT64_C(1) << k) - 1));
+        w->fill += k;
+        while (w->fill >= 8) {
+            w->fill -= 8;
+            putc((int)((w->buffer >> w->fill) & 0xff), w->f);
+        }
+    }
+}
+
+/**
+ * Write x in the gamma code read by bitfile_read_gamma.
+ */
+
+static void write_gamma(offsets_writer *w, uint64_t x)
+{
+    int msb = 0;
+    x++;
+    while ((x >> msb) > 1) { msb++; }
+    write_bits(w, 0, msb);
+    write_bits(w, x, msb + 1);
+}
+
+/**
+ * Load the offsets of a graph from a .ef file saved by 
+ * BVGRAPH_LOAD_SAVE_EF_OFFSETS.  With Elias-Fano offsets and 
+ * offset_step = 1, the saved list becomes the offsets without any 
+ * decoding.
+ *
+ * @param[in] g the graph with its offsets allocated but empty
+ * @param[in] f the open .ef file
+ * @return 0 on success, nonzero if the file is not a list of g->n offsets
+ */
+
+static int load_ef_offsets(bvgraph *g, FILE *f)
+{
+    elias_fano_list saved;
+    int64_t i;
+    if (eflist_load(&saved, f) != 0) { return bvgraph_call_io_error; }
+    if (saved.size != (uint64_t)g->n) {
+        eflist_free(&saved);
+        return bvgraph_call_io_error;
+    }
+    if (g->offsets_ef && g->offset_step == 1) {
+        eflist_free(&g->ef_offsets);
+        g->ef_offsets = saved;
+        return (0);
+    }
+    for (i = 0; i < g->n; i += g->offset_step) {
+        store_offset(g, i, (unsigned long long)eflist_get(&saved, i));
+    }
+    eflist_free(&saved);
+    return (0);
+}
+
+/**
+ * The outdegrees of the last window_size+1 nodes while building offsets.
+ */
+
+struct outdegree_window {
+    int64_t *outd;
+    int size;
+};
+
+/**
+ * The outdegree of a reference for skip_successors while building 
+ * offsets, which is always in the window.
+ */
+
+static int64_t window_outdegree(void *ctx, int64_t y)
+{
+    struct outdegree_window *w = (struct outdegree_window*)ctx;
+    return w->outd[y % w->size];
+}
+
+/**
+ * Build the offsets of a graph without a .offsets file by reading 
+ * the outdegree of each node and skipping its successor list, and save
+ * them if the flags ask for it.  Skipping does not copy references,
+ * merge intervals or fill the window of an iterator, so it is much 
+ * faster than decoding the graph.
+ *
+ * The pass is serial on purpose.  A threaded builder would need a first
+ * serial pass to find where each range starts, and that pass is the 
+ * same skip: on wb-cs.stanford the skip takes 59 ns of the 67 ns spent
+ * on each node, and storing the offset takes the rest.  Re-skipping the
+ * ranges on T threads costs 67/T ns per node to save at most 8, so it
+ * loses below 8 threads and saves little above.
+ *
+ * The .offsets file is gamma coded like the WebGraph offsets, with n+1 
+ * offsets, and is only written if the graph codes its offsets with 
+ * gamma codes.  Both files are written to a temporary file and renamed,
+ * so a concurrent load sees either no file or a complete one.  Failing 
+ * to save is not an error for the load.
+ *
+ * @param[in] g the graph with its offsets allocated but empty
+ * @param[in] flags the load flags
+ * @return 0 on success
+ */
+
+static int build_offsets(bvgraph *g, int flags)
+{
+    bitfile bf;
+    struct outdegree_window window;
+    offsets_writer w = {0};
+    elias_fano_list ef;
+    int save_ef = 0, rval = 0;
+    char *ofilename, *efilename;
+    unsigned long long prev = 0, off;
+    int64_t x;
+
+    window.size = g->window_size + 1;
+    window.outd = malloc(sizeof(int64_t)*window.size);
+    if (!window.outd) { return bvgraph_call_out_of_memory; }
+    bitfile_map(g->memory, g->memory_size, &bf);
+    ofilename = strappend(g->filename, g->filenamelen, ".offsets", 8);
+    efilename = strappend(g->filename, g->filenamelen, ".ef", 3);
+
+    if ((flags & BVGRAPH_LOAD_SAVE_OFFSETS) && 
+        g->offset_coding == BVGRAPH_FLAG_GAMMA) {
+        w.f = ftemp(ofilename, &w.tmpname);
+    }
+    if (flags & BVGRAPH_LOAD_SAVE_EF_OFFSETS) {
+        save_ef = eflist_create(&ef, g->n, 8*(uint64_t)g->memory_size) == 0;
+    }
+
+    for (x = 0; x < g->n && rval == 0; x++) {
+        int64_t d;
+        off = bitfile_tell(&bf);
+        store_offset(g, x, off);
+        if (save_ef) { eflist_add(&ef, (int64_t)off); }
+        if (w.f) { write_gamma(&w, off - prev); }
+        prev = off;
+        d = read_outdegree(g, &bf);
+        window.outd[x % window.size] = d;
+        rval = skip_successors(g, &bf, x, (uint64_t)d, window_outdegree, &window);
+    }
+    // WebGraph also stores the offset of the end of the graph
+    if (w.f) { write_gamma(&w, bitfile_tell(&bf) - prev); }
+    bitfile_close(&bf);
+    free(window.outd);
+    if (rval) {
+        // do not save offsets from a graph we could not read
+        if (w.f) { fdiscard(w.f, w.tmpname); w.f = NULL; }
+        if (save_ef) { eflist_free(&ef); save_ef = 0; }
+    }
+
+    if (w.f) {
+        // pad the last byte with zeros
+        write_bits(&w, 0, (8 - w.fill) & 7);
+        if (ferror(w.f)) { fdiscard(w.f, w.tmpname); }
+        else { fcommit(w.f, w.tmpname, ofilename); }
+    }
+    if (save_ef) {
+        char *tmpname;
+        FILE *f = ftemp(efilename, &tmpname);
+        if (f) {
+            if (eflist_save(&ef, f) == 0) { fcommit(f, tmpname, efilename); }
+            else { fdiscard(f, tmpname); }
+        }
+        eflist_free(&ef);
+    }
+    free(ofilename);
+    free(efilename);
+    return (rval);
+}
+
 /**
  * Create a new bvgraph in the memory.
  * @return A pointer to the newly created bvgraph in the memory.
@@ -82,7 +368,9 @@ void bvgraph_free(bvgraph *g)
  * @param[in] offset_step controls how many offsets are loaded, 
  * if offset_step = -1, then the graph file isn't loaded into memory
  * if offset_step = 0, then the graph file is loaded, but no offsets
- * no other values are supported at the moment.
+ * if offset_step = 1, then the graph file is loaded with all offsets
+ * if offset_step = k > 1, then only the offsets of every k-th node 
+ * are loaded and random access decodes forward from the nearest one
  * @return 0 if successful;
  * bvgraph_load_error_filename_too_long - indicates the filename was too long
  *
@@ -93,9 +381,41 @@ void bvgraph_free(bvgraph *g)
 int bvgraph_load(bvgraph* g, const char *filename, unsigned int filenamelen, int offset_step)
 {
     // this call will treat all the memory as internal
-    return bvgraph_load_external(g, filename, filenamelen, offset_step, NULL, 0, NULL, 0);
+    return bvgraph_load_external(g, filename, filenamelen, offset_step, NULL, 0, NULL, 0, 0);
 }  
 
+/**
+ * Load a graph with the .graph file memory mapped instead of read into
+ * memory.  This call is the same as bvgraph_load_external with 
+ * the BVGRAPH_LOAD_MMAP flag.
+ *
+ * Loading is then nearly instant, the graph does not count against
+ * the memory of the process, and processes that open the same graph share
+ * its pages in the operating system's page cache.  When offset_step >= 1,
+ * the .offsets file is also mapped to decode the offsets.  The 
+ * iterators advise the operating system to read ahead for sequential
+ * scans, and not to for random access.
+ *
+ * This call is only supported on POSIX systems.
+ *
+ * @param[in] g a newly created bvgraph structure
+ * @param[in] filename the base filename for a set of bvgraph files, 
+ * so filename.graph and filename.properties must exist.
+ * @param[in] filenamelen the length of the filename
+ * @param[in] offset_step controls how many offsets are loaded, 
+ * if offset_step = -1, then the graph file isn't mapped at all
+ * if offset_step = 0, then the graph file is mapped, but no offsets
+ * if offset_step >= 1, then the graph file is mapped with offsets
+ * @return 0 if successful;
+ * bvgraph_call_unsupported - if memory mapping is not available
+ */
+int bvgraph_load_mmap(bvgraph *g, 
+                      const char *filename, unsigned int filenamelen, int offset_step)
+{
+    return bvgraph_load_external(g, filename, filenamelen, offset_step, 
+        NULL, 0, NULL, 0, BVGRAPH_LOAD_MMAP);
+}
+
 /**
  * Load a graph file but using a set of externally provided buffers 
  * for the data.  This might be useful in the case that you want to managed
@@ -111,30 +431,52 @@ int bvgraph_load(bvgraph* g, const char *filename, unsigned int filenamelen, int
  * and then call bvgraph_required_memory with an alternative
  * offset step.
  *
+ * The flags only change how the library allocates its own memory:
+ * - BVGRAPH_LOAD_MMAP maps the .graph file instead of reading it
+ *   (see bvgraph_load_mmap)
+ * - BVGRAPH_LOAD_HUGEPAGES puts the graph and the offsets on 2MB 
+ *   transparent huge pages, which saves a TLB miss on most random 
+ *   accesses to a large graph; it does not apply to a mapped graph.
+ *   See bvgraph_hugepage_usage for how well this worked.
+ * - BVGRAPH_LOAD_POPULATE pre-faults a mapped graph; memory that is
+ *   read from the file is always faulted in by the read.
+ * - BVGRAPH_LOAD_EF_OFFSETS stores the offsets for offset_step >= 1 as
+ *   an Elias-Fano list, which takes about 2 + log2(bits per node) bits
+ *   per node instead of 64, at the price of a select for each lookup.
+ * - BVGRAPH_LOAD_SAVE_OFFSETS and BVGRAPH_LOAD_SAVE_EF_OFFSETS save
+ *   the offsets when there is no .offsets file and they have to be 
+ *   rebuilt from the graph, as a gamma coded .offsets file or as a 
+ *   .ef file with a complete Elias-Fano list.  Later loads read the
+ *   .offsets file, or the .ef file if there is no .offsets file.
+ *
  * @param[in] g a newly created bvgraph structure
  * @param[in] filename the base filename for a set of bvgraph files, 
  * so filename.graph and filename.properties must exist.
  * @param[in] offset_step controls how many offsets are loaded, 
  * if offset_step = -1, then the graph file isn't loaded into memory
  * if offset_step = 0, then the graph file is loaded, but no offsets
- * no other values are supported at the moment.
+ * if offset_step = 1, then the graph file is loaded with all offsets
+ * if offset_step = k > 1, then only the offsets of every k-th node 
+ * are loaded and random access decodes forward from the nearest one
  * @param[in] gmemory an arry of size gmemsize for the graph 
  * (if NULL, then this parameter is treated as internal memory)
  * @param[in] gmemsize the size of the gmemory block
  * @param[in] offsets an array of offsets
  * (if NULL, then this parameter is treated as internal memory)
  * @param[in] offsetssize the number of offsets
+ * @param[in] flags a combination of bvgraph_load_flag values, or 0
  * @return 0 if successful;
  * bvgraph_load_error_filename_too_long - indicates the filename was too long
  */
 int bvgraph_load_external(bvgraph *g,
                           const char *filename, unsigned int filenamelen, int offset_step,
                           unsigned char *gmemory, size_t gmemsize,
-                          unsigned long long* offsets, int offsetssize)
+                          unsigned long long* offsets, int offsetssize,
+                          int flags)
 {
     int rval = 0;
 
-    assert(offset_step == 0 || offset_step == -1 || offset_step == 1);
+    assert(offset_step >= -1);
 
     if (filenamelen > BVGRAPH_MAX_FILENAME_SIZE-1) { 
         return bvgraph_load_error_filename_too_long;
@@ -154,10 +496,13 @@ int bvgraph_load_external(bvgraph *g,
     // check for any errors
     if (rval != 0) { return rval; }
 
+    // build the decoding tables for the codes in this graph
+    select_code_tables(g);
+
     // continue processing
     if (offset_step >= 0) 
     {
-        if (offset_step == 0 || offset_step == 1) {    //modified 082911
+        if (offset_step >= 0) {    //modified 082911
             // in this case, we ust load the graph
             // file into memory
 
@@ -179,10 +524,24 @@ int bvgraph_load_external(bvgraph *g,
                 g->memory = gmemory;
                 g->memory_size = gmemsize;
                 g->memory_external = 1;
+            } else if (flags & BVGRAPH_LOAD_MMAP) {
+                gfilename = strappend(g->filename, g->filenamelen, ".graph", 6);
+                rval = fmap(gfilename, &g->memory, &g->memory_size,
+                            flags & BVGRAPH_LOAD_POPULATE);
+                free(gfilename);
+                if (rval) {
+                    return rval;
+                }
+                g->memory_external = 0;
+                g->memory_mapped = 1;
             } else {
                 // we have to allocate the memory ourselves
                 g->memory_size = (size_t)graphfilesize;
-                g->memory = malloc(sizeof(unsigned char)*g->memory_size);
+                if (flags & BVGRAPH_LOAD_HUGEPAGES) {
+                    g->memory = hugepage_alloc(sizeof(unsigned char)*g->memory_size);
+                } else {
+                    g->memory = malloc(sizeof(unsigned char)*g->memory_size);
+                }
                 if (!g->memory) {
                     return bvgraph_call_out_of_memory;
                 }
@@ -190,10 +549,11 @@ int bvgraph_load_external(bvgraph *g,
             }
 
             // now read the file
-            gfilename = strappend(g->filename, g->filenamelen, ".graph", 6);
-            {
+            if (!g->memory_mapped) {
                 size_t bytesread = 0;
-                FILE *gfile = fopen(gfilename, "rb");
+                FILE *gfile;
+                gfilename = strappend(g->filename, g->filenamelen, ".graph", 6);
+                gfile = fopen(gfilename, "rb");
                 free(gfilename);
                 if (!gfile) {
                     return bvgraph_call_io_error;
@@ -206,20 +566,54 @@ int bvgraph_load_external(bvgraph *g,
             }
             // we now have the graph in memory!
 
-            if (offset_step == 1) {        //modified 082911
+            if (offset_step >= 1) {        //modified 082911
                 // now read the file
                 char *ofilename = strappend(g->filename, g->filenamelen, ".offsets", 8);
                 bitfile bf;
                 long long off = 0;
                 int64_t i;
-                FILE *ofile = fopen(ofilename, "rb");
+                FILE *ofile = NULL;
+                unsigned char *omemory = NULL;
+                size_t omemsize = 0;
+
+                if ((flags & BVGRAPH_LOAD_MMAP) && 
+                    fmap(ofilename, &omemory, &omemsize, 0) == 0) {
+                    bitfile_map(omemory, omemsize, &bf);
+                    fmapadvise(omemory, omemsize, 0);
+                } else {
+                    ofile = fopen(ofilename, "rb");
+                }
+                free(ofilename);
 
                 if (offsets != NULL) {
                     g->offsets = offsets;
                     g->offsets_external = 1;
+                } else if (flags & BVGRAPH_LOAD_EF_OFFSETS) {
+                    // every offset is a bit position in the graph file
+                    if (eflist_create(&g->ef_offsets, sampled_offsets(g->n, offset_step), 
+                                      8*(uint64_t)g->memory_size)) {
+                        if (ofile) { fclose(ofile); }
+                        if (omemory) { funmap(omemory, omemsize); }
+                        release_memory(g);
+                        return bvgraph_call_out_of_memory;
+                    }
+                    g->offsets_ef = 1;
+                    g->offsets_external = 0;
                 } else {
                     // we have to allocate the memory ourselves
-                    g->offsets = (unsigned long long*) malloc(sizeof(unsigned long long)*g->n);
+                    if (flags & BVGRAPH_LOAD_HUGEPAGES) {
+                        g->offsets = (unsigned long long*) hugepage_alloc(
+                            sizeof(unsigned long long)*sampled_offsets(g->n, offset_step));
+                    } else {
+                        g->offsets = (unsigned long long*) malloc(
+                            sizeof(unsigned long long)*sampled_offsets(g->n, offset_step));
+                    }
+                    if (!g->offsets) {
+                        if (ofile) { fclose(ofile); }
+                        if (omemory) { funmap(omemory, omemsize); }
+                        release_memory(g);
+                        return bvgraph_call_out_of_memory;
+                    }
                     g->offsets_external = 0;
                 }
 
@@ -228,22 +622,30 @@ int bvgraph_load_external(bvgraph *g,
                     if (rval) {
                         return bvgraph_call_io_error;
                     }
+                }
+                if (ofile || omemory) {
                     for (i = 0; i < g->n; i++){
                         off = read_offset(g, &bf) + off;
-                        g->offsets[i] = off;
+                        store_offset(g, i, off);
                     }
+                    bitfile_close(&bf);
+                    if (ofile) { fclose(ofile); }
+                    if (omemory) { funmap(omemory, omemsize); }
                 } else {
-                    // need to build the offsets
-                    bvgraph_iterator git;
-                    int rval = bvgraph_nonzero_iterator(g, &git);
-                    if (rval) { return rval; }
-                    g->offsets[0] = 0;
-                    for (; bvgraph_iterator_valid(&git); bvgraph_iterator_next(&git)) {
-                        if (git.curr+1 < g->n) {
-                            g->offsets[git.curr+1] = bitfile_tell(&git.bf);
-                        }
+                    // try offsets saved by BVGRAPH_LOAD_SAVE_EF_OFFSETS,
+                    // otherwise we need to build the offsets
+                    char *efilename = strappend(g->filename, g->filenamelen, ".ef", 3);
+                    FILE *efile = fopen(efilename, "rb");
+                    free(efilename);
+                    rval = -1;
+                    if (efile) {
+                        rval = load_ef_offsets(g, efile);
+                        fclose(efile);
+                    }
+                    if (rval) { 
+                        rval = build_offsets(g, flags);
+                        if (rval) { return rval; }
                     }
-                    bvgraph_iterator_free(&git);
                 }
             }
         }
@@ -272,13 +674,45 @@ int bvgraph_load_external(bvgraph *g,
  */
 int bvgraph_close(bvgraph* g)
 {
-    if (!g->memory_external) { free(g->memory); }
-    if (!g->offsets_external) { free(g->offsets); }
+    if (g->memory_mapped) { funmap(g->memory, g->memory_size); }
+    else if (!g->memory_external) { free(g->memory); }
+    if (g->offsets_ef) { eflist_free(&g->ef_offsets); }
+    else if (!g->offsets_external) { free(g->offsets); }
+    free(g->outdegrees);
+    checkpoints_free(g->checkpoints);
+    shared_cache_free(g->shared_cache);
     memset(g, 0, sizeof(bvgraph));
 
     return (0);
 }
 
+/**
+ * Report how many bytes of the graph and its offsets are on huge 
+ * pages, for instance after loading with BVGRAPH_LOAD_HUGEPAGES.
+ *
+ * @param[in] g the graph
+ * @param[out] memory_bytes the bytes of the graph on huge pages
+ * @param[out] offsets_bytes the bytes of the offsets on huge pages
+ * @return 0 on success;
+ * bvgraph_call_unsupported - if the operating system does not report
+ * huge pages
+ */
+int bvgraph_hugepage_usage(bvgraph *g, size_t *memory_bytes, size_t *offsets_bytes)
+{
+    int rval = 0;
+    size_t mbytes = 0, obytes = 0;
+    if (g->memory) { 
+        rval = hugepage_bytes(g->memory, g->memory_size, &mbytes); 
+    }
+    if (rval == 0 && g->offsets) { 
+        rval = hugepage_bytes(g->offsets, 
+            sizeof(unsigned long long)*sampled_offsets(g->n, g->offset_step), &obytes); 
+    }
+    if (memory_bytes) { *memory_bytes = mbytes; }
+    if (offsets_bytes) { *offsets_bytes = obytes; }
+    return (rval);
+}
+
 /**
  * Compute the memory required to load a bvgraph into memory
  * with the desired offset_step.  
@@ -299,7 +733,7 @@ int bvgraph_required_memory(bvgraph *g, int offset_step, size_t *gbuf, size_t *o
         if (gbuf) { *gbuf = 0; }
         if (offsetbuf) { *offsetbuf = 0; }
     }
-    else if (offset_step < 2) {
+    else {
         unsigned long long graphfilesize;
         char *gfilename = strappend(g->filename, g->filenamelen, ".graph", 6);
         int rval = fsize(gfilename, &graphfilesize);
@@ -313,13 +747,12 @@ int bvgraph_required_memory(bvgraph *g, int offset_step, size_t *gbuf, size_t *o
         // it.
         if (offsetbuf) { *offsetbuf = 0; }
 
-        if (offset_step == 1) {
-            if (offsetbuf) { *offsetbuf = sizeof(unsigned long long)*g->n; }
+        if (offset_step >= 1) {
+            if (offsetbuf) { 
+                *offsetbuf = sizeof(unsigned long long)*sampled_offsets(g->n, offset_step); 
+            }
         }
     }
-    else {
-        return bvgraph_call_unsupported;
-    }
 
     return (0);
 }
@@ -331,7 +764,8 @@ int bvgraph_required_memory(bvgraph *g, int offset_step, size_t *gbuf, size_t *o
  * many sequential outdegree calls from a single thread, the 
  * random_access_iterator structure is much more efficient.
  *
- * To use this method, the graph must be loaded with offsets.
+ * To use this method, the graph must be loaded with offsets or have
+ * its outdegrees cached by bvgraph_cache_outdegrees.
  *
  * @param[in] g the bvgraph structure with offsets loaded
  * @param[in] x the node
@@ -342,7 +776,13 @@ int bvgraph_required_memory(bvgraph *g, int offset_step, size_t *gbuf, size_t *o
 int bvgraph_outdegree(bvgraph *g, int64_t x, uint64_t *d) 
 {
     bvgraph_random_iterator ri;
-    int rval = bvgraph_random_access_iterator(g, &ri);
+    int rval;
+    if (g->outdegrees) {
+        if (x < 0 || x >= g->n) { return (bvgraph_vertex_out_of_range); }
+        *d = (uint64_t)g->outdegrees[x];
+        return (0);
+    }
+    rval = bvgraph_random_access_iterator(g, &ri);
     if (rval == 0) {
         rval = bvgraph_random_outdegree(&ri, x, d);
     }
@@ -397,6 +837,9 @@ const char* bvgraph_error_string(int code)
     else if (code == bvgraph_call_unsupported) {
         return "the call tried to perform an unsupported operation";
     }
+    else if (code == bvgraph_call_buffer_too_small) {
+        return "the output buffer is too small for the next successor list";
+    }
     else if (code == bvgraph_load_error_filename_too_long) {
         return "filename too long to store";
     }
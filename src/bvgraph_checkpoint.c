@@ -0,0 +1,290 @@
+/*
+ * David Gleich
+ * Copyright, Stanford University, 2026
+ * 17 October 2026
+ */
+
+/**
+ * @file bvgraph_checkpoint.c
+ * Save the state of a sequential iterator at every step-th node to a
+ * .checkpoints file, so an iterator over a graph without offsets can
+ * start from any checkpoint instead of from node 0.
+ *
+ * The file has a header of CHECKPOINT_HEADER_SIZE uint64_t values
+ * (magic, n, m, window_size, step, count), an index of count+1 uint64_t
+ * values, and the checkpoints as int64_t values.  Checkpoint k for the
+ * node x = k*step is the bit position after x, then the outdegree and the
+ * successors of each node from max(x-window_size,0) to x.
+ *
+ * @version
+ *
+ * 2026-10-17: Initial version
+ *             Validate the header, the index and the records on load
+ *             Stop saving when the iterator reports an error
+ */
+
+#include "bvgraph_internal.h"
+
+#define CHECKPOINT_MAGIC UINT64_C(0x54504b4347564231) /* "1BVGCKPT" */
+#define CHECKPOINT_HEADER_SIZE 6
+
+/** Add the state of an iterator to the checkpoint data.
+ *
+ * @param i the iterator at the checkpoint node
+ * @param data the checkpoint data
+ * @param len the number of values in data, updated
+ * @return 0 on success
+ */
+static int append_checkpoint(bvgraph_iterator *i, bvgraph_int_vector *data,
+                             uint64_t *len)
+{
+    int64_t x = i->curr, y;
+    int64_t first = x - i->g->window_size;
+    uint64_t size = 1;
+    if (first < 0) { first = 0; }
+    for (y = first; y <= x; y++) {
+        size += 1 + (uint64_t)i->outd_cache[y % i->cyclic_buffer_size];
+    }
+    if (int_vector_ensure_size(data, *len + size)) {
+        return (bvgraph_call_out_of_memory);
+    }
+    data->a[(*len)++] = (int64_t)bitfile_tell(&i->bf);
+    for (y = first; y <= x; y++) {
+        int64_t d = i->outd_cache[y % i->cyclic_buffer_size];
+        data->a[(*len)++] = d;
+        if (d > 0) {
+            memcpy(&data->a[*len], i->window[y % i->cyclic_buffer_size].a,
+                sizeof(int64_t)*d);
+        }
+        *len += (uint64_t)d;
+    }
+    return (0);
+}
+
+/** Save the state of a sequential iterator at every step-th node to the
+ * file filename.checkpoints.
+ *
+ * The graph is read once with a sequential iterator.  The file is written
+ * to a temporary file and renamed, so a concurrent load sees either no
+ * file or a complete one.  Each checkpoint stores the successors of the
+ * window of its node, so the file is much smaller than the offsets when
+ * step is larger than the average outdegree times the window size.
+ *
+ * @param[in] g the graph
+ * @param[in] step the number of nodes between checkpoints
+ * @return 0 on success
+ */
+int bvgraph_save_checkpoints(bvgraph *g, int64_t step)
+{
+    bvgraph_iterator iter;
+    bvgraph_int_vector data = {0};
+    uint64_t header[CHECKPOINT_HEADER_SIZE], *index, len = 0;
+    int64_t count, k = 0;
+    char *filename, *tmpname;
+    FILE *f;
+    int rval;
+
+    if (step <= 0) { return (bvgraph_call_unsupported); }
+    count = (g->n + step - 1) / step;
+    index = malloc(sizeof(uint64_t)*(count + 1));
+    if (!index) { return (bvgraph_call_out_of_memory); }
+
+    rval = bvgraph_nonzero_iterator(g, &iter);
+    if (rval) { free(index); return (rval); }
+    while (rval == 0 && bvgraph_iterator_valid(&iter)) {
+        if (iter.curr % step == 0) {
+            index[k++] = len;
+            rval = append_checkpoint(&iter, &data, &len);
+        }
+        if (rval == 0) {
+            rval = bvgraph_iterator_next(&iter);
+            // next reports bvgraph_call_unsupported past the last node
+            if (rval && !bvgraph_iterator_valid(&iter)) { rval = 0; }
+        }
+    }
+    index[count] = len;
+    bvgraph_iterator_free(&iter);
+
+    if (rval == 0) {
+        header[0] = CHECKPOINT_MAGIC;
+        header[1] = (uint64_t)g->n;
+        header[2] = (uint64_t)g->m;
+        header[3] = (uint64_t)g->window_size;
+        header[4] = (uint64_t)step;
+        header[5] = (uint64_t)count;
+        filename = strappend(g->filename, g->filenamelen, ".checkpoints", 12);
+        f = ftemp(filename, &tmpname);
+        if (!f) {
+            rval = bvgraph_call_io_error;
+        } else if (fwrite(header, sizeof(uint64_t), CHECKPOINT_HEADER_SIZE, f)
+                    != CHECKPOINT_HEADER_SIZE ||
+                   fwrite(index, sizeof(uint64_t), count + 1, f) != (size_t)count + 1 ||
+                   fwrite(data.a, sizeof(int64_t), len, f) != len) {
+            fdiscard(f, tmpname);
+            rval = bvgraph_call_io_error;
+        } else if (fcommit(f, tmpname, filename)) {
+            rval = bvgraph_call_io_error;
+        }
+        free(filename);
+    }
+    int_vector_free(&data);
+    free(index);
+    return (rval);
+}
+
+/** Check that the index and the records of loaded checkpoints fit the
+ * graph, so checkpoint_restore never reads past the data.
+ *
+ * @param g the graph
+ * @param c the checkpoints
+ * @return 0 if they are valid
+ */
+static int check_checkpoints(bvgraph *g, const bvgraph_checkpoints *c)
+{
+    int64_t k;
+    // the index is nondecreasing up to the length of the data
+    if (c->index[0] != 0) { return (-1); }
+    for (k = 0; k < c->count; k++) {
+        if (c->index[k+1] < c->index[k]) { return (-1); }
+    }
+    for (k = 0; k < c->count; k++) {
+        const int64_t *r = &c->data[c->index[k]];
+        int64_t x = k*c->step, first = x - g->window_size, y, j;
+        uint64_t size = c->index[k+1] - c->index[k];
+        if (first < 0) { first = 0; }
+        // the bit position, then each outdegree and its successors
+        if (size < 1 || *r++ < 0) { return (-1); }
+        size--;
+        for (y = first; y <= x; y++) {
+            int64_t d;
+            if (size < 1) { return (-1); }
+            d = *r++;
+            size--;
+            if (d < 0 || d > g->n || (uint64_t)d > size) { return (-1); }
+            for (j = 0; j < d; j++) {
+                if (r[j] < 0 || r[j] >= g->n) { return (-1); }
+            }
+            r += d;
+            size -= (uint64_t)d;
+        }
+        if (size != 0) { return (-1); }
+    }
+    return (0);
+}
+
+/** Load the checkpoints in filename.checkpoints into g->checkpoints.
+ *
+ * bvgraph_iterator_seek, bvgraph_foreach and
+ * bvgraph_parallel_iterators_create use the checkpoints to start
+ * iterators on graphs without offsets.  bvgraph_close releases them.
+ *
+ * @param[in] g the graph
+ * @return 0 on success, bvgraph_call_io_error if the file is missing,
+ *         was saved for another graph or is corrupt
+ */
+int bvgraph_load_checkpoints(bvgraph *g)
+{
+    bvgraph_checkpoints *c;
+    uint64_t header[CHECKPOINT_HEADER_SIZE], len, n = (uint64_t)g->n;
+    unsigned long long size;
+    char *filename;
+    FILE *f;
+    int rval = 0;
+
+    filename = strappend(g->filename, g->filenamelen, ".checkpoints", 12);
+    f = fopen(filename, "rb");
+    if (!f || fsize(filename, &size)) {
+        free(filename);
+        if (f) { fclose(f); }
+        return (bvgraph_call_io_error);
+    }
+    free(filename);
+    if (fread(header, sizeof(uint64_t), CHECKPOINT_HEADER_SIZE, f)
+            != CHECKPOINT_HEADER_SIZE ||
+        header[0] != CHECKPOINT_MAGIC || header[1] != n ||
+        header[2] != (uint64_t)g->m || header[3] != (uint64_t)g->window_size ||
+        header[4] == 0 || header[4] > (uint64_t)INT64_MAX ||
+        header[5] != n/header[4] + (n % header[4] != 0) ||
+        size % sizeof(uint64_t) != 0 ||
+        size < sizeof(uint64_t)*(CHECKPOINT_HEADER_SIZE + header[5] + 1)) {
+        fclose(f);
+        return (bvgraph_call_io_error);
+    }
+
+    c = malloc(sizeof(bvgraph_checkpoints));
+    if (!c) { fclose(f); return (bvgraph_call_out_of_memory); }
+    c->step = (int64_t)header[4];
+    c->count = (int64_t)header[5];
+    c->data = NULL;
+    c->index = malloc(sizeof(uint64_t)*(c->count + 1));
+    if (!c->index) {
+        rval = bvgraph_call_out_of_memory;
+    } else if (fread(c->index, sizeof(uint64_t), c->count + 1, f)
+                != (size_t)c->count + 1) {
+        rval = bvgraph_call_io_error;
+    } else {
+        len = c->index[c->count];
+        // the data must be the rest of the file
+        if (len != size/sizeof(int64_t) - CHECKPOINT_HEADER_SIZE - c->count - 1) {
+            rval = bvgraph_call_io_error;
+        } else {
+            c->data = malloc(sizeof(int64_t)*(len > 0 ? len : 1));
+            if (!c->data) { rval = bvgraph_call_out_of_memory; }
+            else if (fread(c->data, sizeof(int64_t), len, f) != len ||
+                     check_checkpoints(g, c)) {
+                rval = bvgraph_call_io_error;
+            }
+        }
+    }
+    fclose(f);
+    if (rval) {
+        checkpoints_free(c);
+        return (rval);
+    }
+    checkpoints_free(g->checkpoints);
+    g->checkpoints = c;
+    return (0);
+}
+
+/** Release loaded checkpoints.
+ *
+ * @param c the checkpoints, or NULL
+ */
+void checkpoints_free(bvgraph_checkpoints *c)
+{
+    if (!c) { return; }
+    free(c->index);
+    free(c->data);
+    free(c);
+}
+
+/** Move a sequential iterator to a checkpoint of its graph.
+ *
+ * @param i the iterator
+ * @param k the checkpoint, in [0,g->checkpoints->count-1]
+ * @return 0 on success
+ */
+int checkpoint_restore(bvgraph_iterator *i, int64_t k)
+{
+    const bvgraph_checkpoints *c = i->g->checkpoints;
+    const int64_t *r = &c->data[c->index[k]];
+    int64_t x = k*c->step, y;
+    int64_t first = x - i->g->window_size;
+    int rval;
+    if (first < 0) { first = 0; }
+    rval = bitfile_position(&i->bf, *r++);
+    for (y = first; y <= x && rval == 0; y++) {
+        bvgraph_int_vector *slot = &i->window[y % i->cyclic_buffer_size];
+        int64_t d = *r++;
+        rval = int_vector_ensure_size(slot, (uint64_t)d);
+        if (rval == 0) {
+            if (d > 0) { memcpy(slot->a, r, sizeof(int64_t)*d); }
+            i->outd_cache[y % i->cyclic_buffer_size] = d;
+            i->curr_outd = d;
+            if (d > i->max_outd) { i->max_outd = d; }
+        }
+        r += d;
+    }
+    if (rval == 0) { i->curr = x; }
+    return (rval);
+}
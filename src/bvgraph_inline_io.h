@@ -14,18 +14,21 @@
  * @version
  *
  * 2008-03-10: Coding started, ported codes from bvgraph_iterator.c
+ * 2026-10-17: Added delta coding to read_coded
+ *             Added Golomb and skewed Golomb coding to read_coded
+ *             Added node_offset
+ *             Sampled offsets in node_offset and added skip_residuals
+ *             Added skip_successors
+ *             Added copy_mask for the fused successor merge
  */
 
 #include "bvgraph_internal.h"
 
 static inline int64_t nat2int(const int64_t x) { return x % 2 == 0 ? x >> 1 : -( ( x + 1 ) >> 1 ); }
 
-static inline int64_t read_coded(bitfile *bf, enum bvgraph_compression_flag_tag c) 
+static inline int64_t read_coded(bitfile *bf, enum bvgraph_compression_flag_tag c, const int b) 
 {
     switch (c) {
-        case BVGRAPH_FLAG_DELTA: 
-        case BVGRAPH_FLAG_GOLOMB:
-        case BVGRAPH_FLAG_SKEWED_GOLOMB:
         case BVGRAPH_FLAG_ARITH:
         case BVGRAPH_FLAG_INTERP:
         case BVGRAPH_FLAG_ZETA:
@@ -35,6 +38,10 @@ static inline int64_t read_coded(bitfile *bf, enum bvgraph_compression_flag_tag
             return bitfile_read_gamma(bf);
             break;
 
+        case BVGRAPH_FLAG_DELTA:
+            return bitfile_read_delta(bf);
+            break;
+
         case BVGRAPH_FLAG_UNARY:
             return bitfile_read_unary(bf);
             break;
@@ -42,23 +49,45 @@ static inline int64_t read_coded(bitfile *bf, enum bvgraph_compression_flag_tag
         case BVGRAPH_FLAG_NIBBLE:
             return bitfile_read_nibble(bf);
             break;
+
+        case BVGRAPH_FLAG_GOLOMB:
+            return bitfile_read_golomb(bf, b);
+            break;
+
+        case BVGRAPH_FLAG_SKEWED_GOLOMB:
+            return bitfile_read_skewed_golomb(bf, b);
+            break;
     }
 
     return (bvgraph_call_unsupported);
 }
-static inline int64_t read_offset(bvgraph *g, bitfile *bf) { return read_coded(bf, g->offset_coding); }
-static inline int64_t read_outdegree(bvgraph *g, bitfile *bf) { return read_coded(bf, g->outdegree_coding); }
+static inline int64_t read_offset(bvgraph *g, bitfile *bf) { return read_coded(bf, g->offset_coding, g->offset_golomb_b); }
+static inline int64_t read_outdegree(bvgraph *g, bitfile *bf) { return read_coded(bf, g->outdegree_coding, g->outdegree_golomb_b); }
 static inline int64_t read_residual(bvgraph *g, bitfile *bf) 
 { 
     if (g->residual_coding == BVGRAPH_FLAG_ZETA) {
         return bitfile_read_zeta(bf,g->zeta_k);
     } else {
-        return read_coded(bf, g->residual_coding); 
+        return read_coded(bf, g->residual_coding, g->residual_golomb_b); 
     }
 }
-static inline int64_t read_reference(bvgraph *g, bitfile *bf) { return read_coded(bf, g->reference_coding); }
-static inline int64_t read_block(bvgraph *g, bitfile *bf) { return read_coded(bf, g->block_coding); }
-static inline int64_t read_block_count(bvgraph *g, bitfile *bf) { return read_coded(bf, g->block_count_coding); }
+static inline int64_t read_reference(bvgraph *g, bitfile *bf) { return read_coded(bf, g->reference_coding, g->reference_golomb_b); }
+static inline int64_t read_block(bvgraph *g, bitfile *bf) { return read_coded(bf, g->block_coding, g->block_golomb_b); }
+static inline int64_t read_block_count(bvgraph *g, bitfile *bf) { return read_coded(bf, g->block_count_coding, g->block_count_golomb_b); }
+
+/** The bit offset of a node in the graph, from whichever form of
+ * offsets the graph was loaded with.  With offset_step > 1, only the
+ * offsets of every offset_step-th node are stored.
+ *
+ * @param g the graph-structure, loaded with offset_step >= 1
+ * @param x the node, a multiple of offset_step
+ */
+static inline unsigned long long node_offset(bvgraph *g, int64_t x)
+{
+    if (g->offset_step > 1) { x /= g->offset_step; }
+    if (g->offsets_ef) { return (unsigned long long)eflist_get(&g->ef_offsets, x); }
+    return g->offsets[x];
+}
 
 /** Skips outdegrees from the given stream. 
  *
@@ -71,8 +100,147 @@ static inline int skip_outdegrees(bvgraph *g, bitfile *bf, const int count)
     switch (g->outdegree_coding) {
         case BVGRAPH_FLAG_GAMMA: return bitfile_skip_gammas(bf,count);
         case BVGRAPH_FLAG_DELTA: return bitfile_skip_deltas(bf,count);
+        case BVGRAPH_FLAG_GOLOMB: 
+        case BVGRAPH_FLAG_SKEWED_GOLOMB: 
+        {
+            int i;
+            for (i = 0; i < count; i++) { read_outdegree(g, bf); }
+            return (0);
+        }
         default: return bvgraph_call_unsupported;
     }
 }
 
+/** Skips residuals from the given stream. 
+ *
+ * @param g the graph-structure
+ * @param bf a graph-file input bit stream.
+ * @param count the number of residuals to skip.
+ */
+static inline int skip_residuals(bvgraph *g, bitfile *bf, const int64_t count) 
+{
+    switch (g->residual_coding) {
+        case BVGRAPH_FLAG_GAMMA: return bitfile_skip_gammas(bf,(int)count);
+        case BVGRAPH_FLAG_DELTA: return bitfile_skip_deltas(bf,(int)count);
+        default: 
+        {
+            int64_t i;
+            for (i = 0; i < count; i++) { read_residual(g, bf); }
+            return (0);
+        }
+    }
+}
+
+/** Skips the successor list of a node, after its outdegree.
+ *
+ * <P><strong>Warning</strong>: This method duplicates unavoidably part of the
+ * logic of bvgraph_random_successors and bvgraph_iterator_next; they must 
+ * remain tightly coupled.
+ *
+ * @param g the graph-structure
+ * @param bf a graph-file input bit stream, just after the outdegree of x
+ * @param x the node
+ * @param d the outdegree of x
+ * @param ref_outdegree returns the outdegree of a node before x in its 
+ *        window, or a negative error; it is only called when the 
+ *        successor list copies the end of the list of its reference
+ * @param ctx the first argument of ref_outdegree
+ * @return 0 on success
+ */
+static inline int skip_successors(bvgraph *g, bitfile *bf, int64_t x, uint64_t d,
+    int64_t (*ref_outdegree)(void *ctx, int64_t y), void *ctx)
+{
+    int64_t ref = -1, extra_count = (int64_t)d;
+    int64_t i, interval_count;
+
+    if (d == 0) { return (0); }
+
+    if (g->window_size > 0) { ref = read_reference(g, bf); }
+
+    if (ref > 0) {
+        int64_t block_count = read_block_count(g, bf);
+        int64_t copied = 0, total = 0;
+        for (i = 0; i < block_count; i++) {
+            int64_t block = read_block(g, bf) + (i == 0 ? 0 : 1);
+            total += block;
+            if (i % 2 == 0) { copied += block; }
+        }
+        if (block_count % 2 == 0) {
+            // the rest of the reference list is copied
+            int64_t outd_ref = ref_outdegree(ctx, x - ref);
+            if (outd_ref < 0) { return ((int)outd_ref); }
+            copied += outd_ref - total;
+        }
+        extra_count = d - copied;
+    }
+
+    if (extra_count > 0 && g->min_interval_length != 0 && 
+        (interval_count = bitfile_read_gamma(bf)) != 0) {
+        for (i = 0; i < interval_count; i++) {
+            bitfile_skip_gammas(bf, 1); // the left endpoint
+            extra_count -= bitfile_read_gamma(bf) + g->min_interval_length;
+        }
+    }
+
+    if (extra_count > 0) {
+        return skip_residuals(g, bf, extra_count);
+    }
+    return (0);
+}
+
+/** The state of a walk over the successors of a reference that a 
+ * successor list copies, as given by its copy blocks.  Even blocks are
+ * copied and odd blocks are skipped; with an even number of blocks, the 
+ * rest of the reference list is copied too.
+ */
+struct copy_mask {
+    const int64_t *block;   ///< the copy blocks
+    int64_t block_count;    ///< the number of copy blocks
+    int64_t outd_ref;       ///< the outdegree of the reference
+    int64_t i;              ///< the next position in the reference list
+    int64_t run;            ///< the copies left in the current block
+    int64_t mask_index;     ///< the next block
+};
+
+/** Start a walk over the copied successors of a reference.
+ *
+ * @param m the walk
+ * @param block the copy blocks
+ * @param block_count the number of copy blocks, 0 without a reference
+ * @param outd_ref the outdegree of the reference, 0 without a reference
+ */
+static inline void copy_mask_init(struct copy_mask *m, const int64_t *block,
+    int64_t block_count, int64_t outd_ref)
+{
+    m->block = block;
+    m->block_count = block_count;
+    m->outd_ref = outd_ref;
+    m->i = 0;
+    m->run = 0;
+    m->mask_index = 0;
+}
+
+/** The position in the reference list of the next copied successor.
+ *
+ * @param m the walk
+ * @return the position, or -1 once every copied successor was returned
+ */
+static inline int64_t copy_mask_next(struct copy_mask *m)
+{
+    while (m->run == 0) {
+        if (m->mask_index < m->block_count) {
+            if (m->mask_index % 2 == 0) { m->run = m->block[m->mask_index++]; }
+            else { m->i += m->block[m->mask_index++]; }
+        } else if (m->mask_index == m->block_count && m->block_count % 2 == 0) {
+            m->run = m->outd_ref - m->i;
+            m->mask_index++;
+        } else {
+            m->run = -1;
+        }
+    }
+    if (m->run < 0) { return (-1); }
+    m->run--;
+    return (m->i++);
+}
+
 //inline int fill_node_buffers(bvgraph *g, bitfile *bf,
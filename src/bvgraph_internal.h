@@ -14,6 +14,15 @@
  * @version
  * 
  *  2008-05-08: Added int_vector_create_copy
+ *  2026-10-17: Added fmap, funmap and fmapadvise
+ *              Added hugepage_alloc and hugepage_bytes
+ *              Added ftemp, fcommit and fdiscard
+ *              Added int32_vector routines
+ *              Added merge_successors
+ *              Added checkpoints_free and checkpoint_restore
+ *              Added the shared cache routines
+ *              Moved OUTD_MEMO_SIZE from bvgraph_random.c
+ *              Added random_successors_unshared
  */ 
 
 #include "bvgraph.h"
@@ -33,6 +42,14 @@ const char* strchrn(const char* str, uint len, int c);
 extern void fnextline(FILE *f);
 extern void fskipchars(FILE *f, const char *schars, uint scharslen);
 extern int fsize(const char *filename, unsigned long long *s);
+extern int fmap(const char *filename, unsigned char **mem, size_t *len, int populate);
+extern int funmap(unsigned char *mem, size_t len);
+extern void fmapadvise(unsigned char *mem, size_t len, int random);
+extern void* hugepage_alloc(size_t size);
+extern int hugepage_bytes(const void *mem, size_t len, size_t *bytes);
+extern FILE* ftemp(const char *filename, char **tmpname);
+extern int fcommit(FILE *f, char *tmpname, const char *filename);
+extern void fdiscard(FILE *f, char *tmpname);
 
 extern int parse_compression_flags(bvgraph* g, const char* flagstr, uint len);
 extern char* parse_property_key(FILE *f, uint maxproplen);
@@ -43,6 +60,35 @@ extern int int_vector_create(bvgraph_int_vector* v, uint64_t n);
 extern int int_vector_create_copy(bvgraph_int_vector* u, bvgraph_int_vector *v);
 extern int int_vector_ensure_size(bvgraph_int_vector *v, uint64_t n);
 extern int int_vector_free(bvgraph_int_vector* v);
+extern int int32_vector_create(bvgraph_int32_vector* v, uint64_t n);
+extern int int32_vector_ensure_size(bvgraph_int32_vector *v, uint64_t n);
+extern int int32_vector_free(bvgraph_int32_vector* v);
+
+extern void merge_successors(bvgraph *g, bitfile *bf, int64_t x, int64_t d,
+    const int64_t *ref_links, int64_t outd_ref,
+    const int64_t *block, int64_t block_count,
+    const int64_t *left, const int64_t *len, int64_t interval_count,
+    int64_t residual_count, int64_t *out);
+extern void merge_successors32(bvgraph *g, bitfile *bf, int64_t x, int64_t d,
+    const uint32_t *ref_links, int64_t outd_ref,
+    const int64_t *block, int64_t block_count,
+    const int64_t *left, const int64_t *len, int64_t interval_count,
+    int64_t residual_count, uint32_t *out);
+
+/** The number of entries in the outdegree memo of a random iterator */
+#define OUTD_MEMO_SIZE 4096
+
+extern void checkpoints_free(bvgraph_checkpoints *c);
+extern int checkpoint_restore(bvgraph_iterator *i, int64_t k);
+
+extern void shared_cache_free(struct bvgraph_shared_cache_tag *c);
+extern bvgraph_shared_list* shared_cache_find(struct bvgraph_shared_cache_tag *c,
+    int64_t x);
+extern bvgraph_shared_list* shared_cache_insert(struct bvgraph_shared_cache_tag *c,
+    int64_t x, int64_t d, const int64_t *a);
+
+extern int random_successors_unshared(bvgraph_random_iterator *ri, int64_t x,
+    int64_t** start, uint64_t *length);
 
 //
 // bvgraph_io routines
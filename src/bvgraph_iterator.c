@@ -22,6 +22,30 @@
  * 2008-03-10: Refactored read_* routines into bvgraph_io.c
  * 2008-03-11: Correctly close the bitfile file pointers
  * 2008-05-08: Set graph max_outd when closing the a valid iterator now 
+ * 2026-10-17: Advise the OS of the access pattern for memory mapped graphs
+ *             Allow offset_step > 1 for sequential and random iterators
+ *             Decode into spare vectors and swap them into the window 
+ *             instead of copying the successors
+ *             Moved the sequential iterator into bvgraph_iterator_template.h
+ *             and added the 32-bit bvgraph_iterator32
+ *             Removed buf1 and buf2, the successors are merged in one pass
+ *             Moved merge_int_arrays to bvgraph_merge.c
+ *             Added bvgraph_iterator_seek, bvgraph_foreach and
+ *             bvgraph_foreach_batch
+ *             Added bvgraph_iterator_next_batch
+ *             Added bvgraph_async_iterator with a helper decode thread
+ *             Compute the average balance from an outdegree scan
+ *             Seek and split parallel iterators with iterator checkpoints
+ *             Allocate the reference chain of the random access iterator
+ *             Start the random access iterator with an empty successor cache
+ *             Decode the seek node without the shared cache, whose lists 
+ *             do not leave the random access iterator at their end
+ *             and without a shared list
+ *             Size the batch of bvgraph_foreach_batch by the average degree
+ *             Return bvgraph_call_buffer_too_small from next_batch
+ *             Allocate the outdegree memo and the earlier outdegree window
+ *             of the random access iterator
+ *             Start the random access iterator without a walk to continue
  */
  
 /** @todo
@@ -34,113 +58,104 @@
 
 #include "debug.h"
 
-/**
- * Create a non-zero iterator for the bvgraph.  The non-zero iterator is 
- * a new object like structure that iterates over the successors of each node
- * in the graph.  There can be many nonzero iterators and each nonzero iterator
- * is independent.
- *
- * The nonzero iterator requires persistent memory to work and is useful
- * for a single iteration over the file.  Each new iteration requires a new
- * nonzero iterator at present.
+#if defined(__unix__) || defined(__APPLE__)
+#define HAVE_PTHREADS
+#include <pthread.h>
+#endif /* __unix__ || __APPLE__ */
+
+
+#define BVG_NODE int64_t
+#define BVG_NODE_MAX INT64_MAX
+#define BVG_ITERATOR bvgraph_iterator
+#define BVG_VECTOR bvgraph_int_vector
+#define BVG_VECTOR_CREATE int_vector_create
+#define BVG_VECTOR_ENSURE int_vector_ensure_size
+#define BVG_VECTOR_FREE int_vector_free
+#define BVG_CREATE bvgraph_nonzero_iterator
+#define BVG_OUTEDGES bvgraph_iterator_outedges
+#define BVG_MERGE_SUCCESSORS merge_successors
+#define BVG_SWAP int_vector_swap
+#define BVG_NEXT bvgraph_iterator_next
+#define BVG_VALID bvgraph_iterator_valid
+#define BVG_FREE bvgraph_iterator_free
+#include "bvgraph_iterator_template.h"
+
+#define BVG_NODE uint32_t
+#define BVG_NODE_MAX UINT32_MAX
+#define BVG_ITERATOR bvgraph_iterator32
+#define BVG_VECTOR bvgraph_int32_vector
+#define BVG_VECTOR_CREATE int32_vector_create
+#define BVG_VECTOR_ENSURE int32_vector_ensure_size
+#define BVG_VECTOR_FREE int32_vector_free
+#define BVG_CREATE bvgraph_nonzero_iterator32
+#define BVG_OUTEDGES bvgraph_iterator32_outedges
+#define BVG_MERGE_SUCCESSORS merge_successors32
+#define BVG_SWAP int32_vector_swap
+#define BVG_NEXT bvgraph_iterator32_next
+#define BVG_VALID bvgraph_iterator32_valid
+#define BVG_FREE bvgraph_iterator32_free
+#include "bvgraph_iterator_template.h"
+
+/** Allocate the reference chain of a random access iterator with a level
+ * for each reference a chain of the graph can follow.
  *
- * @param[in] g the graph
- * @param[in] i the iterator
+ * @param[in] i the random iterator
+ * @param[in] outd_alloc the initial size of the successors of each level
  * @return 0 on success
  */
-int bvgraph_nonzero_iterator(bvgraph* g, bvgraph_iterator *i)
+static int create_chain(bvgraph_random_iterator *i, int outd_alloc)
 {
-    int rval = 0;
-    int64_t outd_alloc = 10;
-    int windcount = 0;
-
-    // check and see if we know something better about the maximum outdegree
-    if (g->max_outd != 0) {
-        // if we set this variable, then we will avoid all
-        // reallocations as we pass through the file.  I'm not 
-        // sure if that is an issue, but it may be.
-        outd_alloc = g->max_outd;
-        i->max_outd = g->max_outd;
-    }
-    else {
-        i->max_outd = 0; 
-    }
-
-    i->g = g;
-    i->curr = -1;
-    i->curr_outd = -1;
-    i->cyclic_buffer_size = i->g->window_size+1;
-
-    if (g->offset_step == -1) {
-        char *graphfilename = strappend(g->filename, g->filenamelen, ".graph", 6);
-        FILE *f = fopen(graphfilename, "rb");
-        free(graphfilename);
-        if (!f) { return bvgraph_call_io_error; }
-
-        rval = bitfile_open(f,&i->bf);
-        if (rval) { return rval; }
-    } else if (g->offset_step == 0 || g->offset_step == 1) {
-        rval = bitfile_map(g->memory, g->memory_size, &i->bf);
-    } else {
-        return bvgraph_call_unsupported;
+    int levels = 4;
+    if (i->g->max_ref_count >= 0 && i->g->max_ref_count < 64) {
+        levels = i->g->max_ref_count + 1;
     }
-
-    // beyond this point, the bitfile was successfully allocated, so we must 
-    // deallocate it if we exit.
-
-    i->outd_cache = malloc(sizeof(int64_t)*i->cyclic_buffer_size);
-    if (i->outd_cache) {
-        i->window = malloc(sizeof(bvgraph_int_vector)*i->cyclic_buffer_size);
-        if (i->window) {
-            rval = int_vector_create(&i->successors, outd_alloc);
-            if (rval == 0) {
-                for (windcount = 0; windcount < i->cyclic_buffer_size; windcount++) {
-                    rval = int_vector_create(&i->window[windcount], outd_alloc);
-                    if (rval != 0) { break; }
-                }
-
-                // 
-                // this statement here indicates we should return
-                // with success and a correctly allocated 
-                // interator
-                //
-                
-                rval = int_vector_create(&i->block, outd_alloc);
-                rval = int_vector_create(&i->left, outd_alloc);
-                rval = int_vector_create(&i->len, outd_alloc);
-                rval = int_vector_create(&i->buf1, outd_alloc);
-                rval = int_vector_create(&i->buf2, outd_alloc);
-
-                if (rval == 0) { 
-                    rval = bvgraph_iterator_next(i);
-                    if (rval == 0) {
-                        return (0); 
-                    }
-                    // we failed to fetch the first set of
-                    // indices, this indicates that we 
-                    // failed in creation and should free
-                    // ourselves
-                }
-
-                // in this case, we have to free everything allocated
-                while (windcount >= 0) {
-                    int_vector_free(&i->window[windcount]);
-                    windcount--;
-                }
-
-                int_vector_free(&i->successors);
+    i->chain = malloc(sizeof(struct bvgraph_chain_level_tag)*levels);
+    if (!i->chain) { return bvgraph_call_out_of_memory; }
+    for (i->chain_size = 0; i->chain_size < levels; i->chain_size++) {
+        if (int_vector_create(&i->chain[i->chain_size].links, outd_alloc)) {
+            while (i->chain_size > 0) {
+                int_vector_free(&i->chain[--i->chain_size].links);
             }
-            free(i->window);
+            free(i->chain);
+            i->chain = NULL;
+            return bvgraph_call_out_of_memory;
         }
-        else { rval = bvgraph_call_out_of_memory; }
+    }
+    return (0);
+}
 
-        free(i->outd_cache);
-    } 
-    else { rval = bvgraph_call_out_of_memory; }
-    bitfile_close(&i->bf);
-    if (i->bf.f) { fclose(i->bf.f); } 
-  
-    return rval;
+/** Allocate the outdegree memo, the bit positions of the walks and the
+ * first earlier outdegree window of a random access iterator, which walks
+ * from the stored offsets when offset_step > 1, so a query does not 
+ * allocate them.
+ *
+ * @param[in] i the random iterator
+ * @return 0 on success
+ */
+static int create_walk_buffers(bvgraph_random_iterator *i)
+{
+    int k;
+    if (i->offset_step <= 1) { return (0); }
+    i->outd_memo = malloc(sizeof(int64_t)*2*OUTD_MEMO_SIZE);
+    i->walk_pos = malloc(sizeof(int64_t)*i->cyclic_buffer_size);
+    i->earlier_outd = malloc(sizeof(int64_t*));
+    if (i->earlier_outd) {
+        i->earlier_outd[0] = malloc(sizeof(int64_t)*i->cyclic_buffer_size);
+    }
+    if (!i->outd_memo || !i->walk_pos || !i->earlier_outd || 
+        !i->earlier_outd[0]) {
+        if (i->earlier_outd) { free(i->earlier_outd[0]); }
+        free(i->earlier_outd);
+        free(i->walk_pos);
+        free(i->outd_memo);
+        i->earlier_outd = NULL;
+        i->walk_pos = NULL;
+        i->outd_memo = NULL;
+        return bvgraph_call_out_of_memory;
+    }
+    i->earlier_size = 1;
+    for (k = 0; k < OUTD_MEMO_SIZE; k++) { i->outd_memo[2*k] = -1; }
+    return (0);
 }
 
 /**
@@ -175,7 +190,16 @@ int bvgraph_random_access_iterator(bvgraph* g, bvgraph_random_iterator *i)
     i->cyclic_buffer_size = i->g->window_size+1;
 
     // for successors cache
-    i->successors_cache = NULL;
+    memset(&i->cache, 0, sizeof(i->cache));
+    i->shared = NULL;
+    i->outd_memo = NULL;
+    i->earlier_outd = NULL;
+    i->earlier_size = 0;
+    i->earlier_depth = 0;
+    i->walk_node = -1;
+    i->walk_pos = NULL;
+    i->chain = NULL;
+    i->chain_size = 0;
 
     if (g->offset_step < 1) {
         return bvgraph_call_unsupported;
@@ -183,10 +207,11 @@ int bvgraph_random_access_iterator(bvgraph* g, bvgraph_random_iterator *i)
 
     rval = bitfile_map(g->memory, g->memory_size, &i->bf);
     rval |= bitfile_map(g->memory, g->memory_size, &i->outd_bf);
+    if (g->memory_mapped) { fmapadvise(g->memory, g->memory_size, 1); }
 
     // TODO deallocate these on failure
 
-    i->offset_step = 1;
+    i->offset_step = g->offset_step;
 
     // beyond this point, the bitfile was successfully allocated, so we must 
     // deallocate it if we exit.
@@ -194,7 +219,7 @@ int bvgraph_random_access_iterator(bvgraph* g, bvgraph_random_iterator *i)
     if (i->outd_cache) {
         i->window = malloc(sizeof(bvgraph_int_vector)*i->cyclic_buffer_size);
         if (i->window) {
-            rval = int_vector_create(&i->successors, outd_alloc);
+            rval = create_chain(i, outd_alloc);
             if (rval == 0) {
                 for (windcount = 0; windcount < i->cyclic_buffer_size; windcount++) {
                     rval = int_vector_create(&i->window[windcount], outd_alloc);
@@ -208,8 +233,7 @@ int bvgraph_random_access_iterator(bvgraph* g, bvgraph_random_iterator *i)
                 rval = int_vector_create(&i->block, outd_alloc);
                 rval |= int_vector_create(&i->left, outd_alloc);
                 rval |= int_vector_create(&i->len, outd_alloc);
-                rval |= int_vector_create(&i->buf1, outd_alloc);
-                rval |= int_vector_create(&i->buf2, outd_alloc);
+                if (rval == 0) { rval = create_walk_buffers(i); }
                 
                 if (rval == 0) {
                     // we successfully allocated everything
@@ -217,7 +241,6 @@ int bvgraph_random_access_iterator(bvgraph* g, bvgraph_random_iterator *i)
                 }
 
                 // TODO figure out how to release i->block, i->left, i->len
-                // i->buf1, i->buf2
                 //
 
                 // in this case, we have to free everything allocated
@@ -226,7 +249,10 @@ int bvgraph_random_access_iterator(bvgraph* g, bvgraph_random_iterator *i)
                     windcount--;
                 }
                 
-                int_vector_free(&i->successors);
+                while (i->chain_size > 0) {
+                    int_vector_free(&i->chain[--i->chain_size].links);
+                }
+                free(i->chain);
             }
             free(i->window);
         }
@@ -242,332 +268,535 @@ int bvgraph_random_access_iterator(bvgraph* g, bvgraph_random_iterator *i)
     return rval;
 }
 
-/**
- * This routine provides access to the successors array stored inside
- * the iterator, so the successor array will be invalidated after 
- * a call to iterator_next.
- * 08/28/11
- * @param[out] start starting point of links (array)
- * @param[out] len outdegree
+/** Move a sequential iterator to node x.
+ *
+ * Nodes a little after the current node, and any later node of a graph
+ * without offsets, are reached by stepping the iterator.  Otherwise, the
+ * successors of x and of the window before x are decoded with a random 
+ * access iterator, and the iterator continues from the end of x.  A 
+ * graph without offsets but with checkpoints from 
+ * bvgraph_load_checkpoints restarts from the last checkpoint before x
+ * instead.  Moving back requires offsets or checkpoints.
+ *
+ * @param[in] i the iterator
+ * @param[in] x the node, in [0,g->n-1]
  * @return 0 on success
  */
-int bvgraph_iterator_outedges(bvgraph_iterator* i, int64_t** start, uint64_t* len)
+int bvgraph_iterator_seek(bvgraph_iterator *i, int64_t x)
 {
-    if (start) { *start = i->successors.a; }
-    if (len) { *len = i->curr_outd; }
+    bvgraph *g = i->g;
+    bvgraph_random_iterator ri;
+    int64_t y, first;
+    int rval = 0;
 
-    return (0);
-}
+    if (!g || x < 0 || x >= g->n) { return bvgraph_vertex_out_of_range; }
 
-/**
- * Merege two sorted arrays into a single sorted array.
- *
- * @param[in] a1 the first array
- * @param[in] a1len the length of the first array
- * @param[in] a2 the second array
- * @param[in] a2len the length of the second array
- * @param[out] out the final array
- * @param[out] outlen the length of the output array
- * @return 0 on success
- */
-int merge_int_arrays(const int64_t* a1, size_t a1len, const int64_t* a2, 
-                     size_t a2len, int64_t *out, size_t outlen)
-{
-    size_t a1i=0, a2i=0, oi=0;
-    // make sure we don't have to worry about having enough space
-    if (outlen < a1len + a2len) {
-        return bvgraph_call_unsupported; 
+    if (g->offset_step <= 0 && g->checkpoints) {
+        int64_t k = x / g->checkpoints->step;
+        if (x < i->curr || 
+            k*g->checkpoints->step > i->curr + i->cyclic_buffer_size) {
+            rval = checkpoint_restore(i, k);
+        }
+        while (i->curr < x && rval == 0) { rval = bvgraph_iterator_next(i); }
+        return rval;
     }
-    while (a1i < a1len && a2i < a2len) {
-        out[oi++] = a1[a1i] < a2[a2i] ? a1[a1i++] : a2[a2i++];
+    if (x >= i->curr && 
+        (g->offset_step <= 0 || x - i->curr <= i->cyclic_buffer_size)) {
+        while (i->curr < x && rval == 0) { rval = bvgraph_iterator_next(i); }
+        return rval;
     }
-    if (a1i < a1len) {
-        memcpy(&out[oi], &a1[a1i], (a1len - a1i)*sizeof(int64_t));
-    } else {
-        memcpy(&out[oi], &a2[a2i], (a2len - a2i)*sizeof(int64_t));
+    if (g->offset_step <= 0) { return bvgraph_requires_offsets; }
+
+    rval = bvgraph_random_access_iterator(g, &ri);
+    if (rval) { return rval; }
+
+    // a node only refers to nodes in its window
+    first = x - g->window_size;
+    if (first < 0) { first = 0; }
+    for (y = first; y <= x && rval == 0; y++) {
+        bvgraph_int_vector *slot = &i->window[y % i->cyclic_buffer_size];
+        int64_t *links;
+        uint64_t d;
+        // decode x even if it is in the shared cache, to leave ri.bf 
+        // at the end of x
+        if (y < x) { rval = bvgraph_random_successors(&ri, y, &links, &d); }
+        else { rval = random_successors_unshared(&ri, y, &links, &d); }
+        if (rval == 0) { rval = int_vector_ensure_size(slot, d); }
+        if (rval == 0) {
+            if (d > 0) { memcpy(slot->a, links, sizeof(int64_t)*d); }
+            i->outd_cache[y % i->cyclic_buffer_size] = (int64_t)d;
+            i->curr_outd = (int64_t)d;
+            if ((int64_t)d > i->max_outd) { i->max_outd = (int64_t)d; }
+        }
     }
-    return (0);
+    if (rval == 0) {
+        // the random access iterator stops at the end of x
+        rval = bitfile_position(&i->bf, bitfile_tell(&ri.bf));
+        i->curr = x;
+    }
+    bvgraph_random_free(&ri);
+    return (rval);
 }
 
-/**
- * Load the next set of successors into the i->successors array.  This
- * routine invalidates the current set of successors.
+/** Decode consecutive nodes into a compressed sparse row chunk.
  *
- * @todo Optimize memory usage in this routine.
+ * The chunk starts with the current node of the iterator and takes
+ * nodes until it has max_nodes nodes, the next node does not fit in 
+ * max_edges, or the iterator ends.  The iterator is left at the first 
+ * node after the chunk, so repeated calls cover the graph:
  *
- * @param[in] iter the iterator
- * @return 0 on success
+ *   while (bvgraph_iterator_next_batch(&i, nn, ne, &chunk) == 0 &&
+ *          chunk.nodes > 0) { ... }
+ *
+ * @param[in] i the iterator
+ * @param[in] max_nodes the largest number of nodes in the chunk
+ * @param[in] max_edges the largest number of edges in the chunk
+ * @param[in,out] chunk the chunk, with the arrays rowstart and links 
+ *                allocated by the caller
+ * @return 0 on success, bvgraph_call_buffer_too_small if the 
+ *         current node alone has more than max_edges successors
  */
-int bvgraph_iterator_next(bvgraph_iterator* iter)
+int bvgraph_iterator_next_batch(bvgraph_iterator *i, int64_t max_nodes,
+                                uint64_t max_edges, bvgraph_csr_chunk *chunk)
 {
-    const int64_t x = ++(iter->curr);
-    int64_t ref = 0, ref_index = 0;
-    int64_t i = 0, extra_count = 0, block_count = 0;
+    int rval = 0;
 
-    // TODO: make these static arrays for the iterator
-    // bvgraph_int_vector block, left, len, buf1, buf2;
+    chunk->first = i->curr;
+    chunk->nodes = 0;
+    chunk->edges = 0;
+    if (max_nodes <= 0) { return bvgraph_call_unsupported; }
+    chunk->rowstart[0] = 0;
+
+    while (chunk->nodes < max_nodes && bvgraph_iterator_valid(i)) {
+        uint64_t d = (uint64_t)i->curr_outd;
+        if (chunk->edges + d > max_edges) {
+            if (chunk->nodes == 0) { rval = bvgraph_call_buffer_too_small; }
+            break;
+        }
+        if (d > 0) {
+            memcpy(&chunk->links[chunk->edges], 
+                i->window[i->curr % i->cyclic_buffer_size].a, sizeof(int64_t)*d);
+        }
+        chunk->edges += d;
+        chunk->rowstart[++chunk->nodes] = chunk->edges;
 
-    bvgraph *g = iter->g;
-    bitfile *bf = &iter->bf;
+        // stepping past the last node is not an error here
+        rval = bvgraph_iterator_next(i);
+        if (!bvgraph_iterator_valid(i)) { rval = 0; }
+        if (rval) { break; }
+    }
+    return (rval);
+}
 
-    int64_t d, copied, total, interval_count;
-    int64_t buf1_index, buf2_index;
+/** Call a function with the successors of each node in a range.
+ *
+ * This routine runs the loop of a sequential iterator inside the 
+ * library, so a visitor only pays for one call per node.  The iterator 
+ * jumps to start with bvgraph_iterator_seek, so without offsets the 
+ * nodes before start are decoded but not visited.
+ *
+ * @param[in] g the graph
+ * @param[in] start the first node
+ * @param[in] end one past the last node, at most g->n
+ * @param[in] visit the callback, see bvgraph_visitor
+ * @param[in] ctx the first argument of visit
+ * @return 0 on success, the first nonzero value from visit, or an error
+ */
+int bvgraph_foreach(bvgraph *g, int64_t start, int64_t end,
+                    bvgraph_visitor visit, void *ctx)
+{
+    bvgraph_iterator iter;
+    int64_t x;
+    int rval;
 
-    // make sure the iterator is still valid
-    if (!bvgraph_iterator_valid(iter)) {
-        return bvgraph_call_unsupported;
+    if (start < 0 || start > end || end > g->n) { 
+        return bvgraph_vertex_out_of_range; 
     }
+    if (start == end) { return (0); }
 
-    d = iter->outd_cache[x%iter->cyclic_buffer_size]=read_outdegree(g, bf);
-    iter->curr_outd = d;
+    rval = bvgraph_nonzero_iterator(g, &iter);
+    if (rval) { return rval; }
+    rval = bvgraph_iterator_seek(&iter, start);
+    for (x = start; x < end && rval == 0; x++) {
+        if (x > start) { rval = bvgraph_iterator_next(&iter); }
+        if (rval == 0) {
+            rval = visit(ctx, x, iter.window[x % iter.cyclic_buffer_size].a,
+                (uint64_t)iter.curr_outd);
+        }
+    }
+    bvgraph_iterator_free(&iter);
+    return (rval);
+}
 
-    if (d > iter->max_outd) { iter->max_outd = d; }
+/** Call a function with the successors of batches of nodes in a range.
+ *
+ * The successors of up to batch nodes are gathered into one array, in 
+ * the layout of a compressed sparse row matrix, for each call.
+ *
+ * @param[in] g the graph
+ * @param[in] start the first node
+ * @param[in] end one past the last node, at most g->n
+ * @param[in] batch the largest number of nodes for each call
+ * @param[in] visit the callback, see bvgraph_batch_visitor
+ * @param[in] ctx the first argument of visit
+ * @return 0 on success, the first nonzero value from visit, or an error
+ */
+int bvgraph_foreach_batch(bvgraph *g, int64_t start, int64_t end, 
+                          int64_t batch, bvgraph_batch_visitor visit, 
+                          void *ctx)
+{
+    bvgraph_iterator iter;
+    bvgraph_int_vector links;
+    uint64_t *rowstart, size;
+    int64_t x, first = start;
+    int rval;
 
-    if (d == 0) {
-        // nothing to do!
-        return (0);
+    if (start < 0 || start > end || end > g->n) { 
+        return bvgraph_vertex_out_of_range; 
     }
+    if (batch <= 0) { return bvgraph_call_unsupported; }
+    if (start == end) { return (0); }
+
+    rowstart = malloc(sizeof(uint64_t)*(batch+1));
+    if (!rowstart) { return bvgraph_call_out_of_memory; }
+    // start from the average degree, the largest list or one id per node,
+    // and let the doubling below handle heavier batches
+    size = (uint64_t)batch*(uint64_t)(g->m/g->n + 1);
+    if ((uint64_t)g->max_outd > size) { size = (uint64_t)g->max_outd; }
+    rval = int_vector_create(&links, size);
+    if (rval) { free(rowstart); return rval; }
 
-    // allocate the structures
-    // TODO perform error checking here
-    /*int_vector_create(&block, 10);
-    int_vector_create(&left, 10);
-    int_vector_create(&len, 10);
-
-    // allocate a sufficient buffer for the output
-    int_vector_ensure_size(&iter->successors, d);
-    int_vector_create(&buf1, d);
-    int_vector_create(&buf2, d);*/
-
-    int_vector_ensure_size(&iter->successors, d);
-    int_vector_ensure_size(&iter->buf1, d);
-    int_vector_ensure_size(&iter->buf2, d);
-
-    TRACE((DEBUG_DEEP, "** begin successors\ncurr = %"PRINTF_INT64_MODIFIER"\n"
-                            "d=%"PRINTF_INT64_MODIFIER"\n", 
-                            iter->curr, d));            
-    // we read the reference only if the actual window size is larger than one 
-    // (i.e., the one specified by the user is larger than 0).
-    if ( g->window_size > 0 ) {
-        ref = read_reference(g, bf);
-        // TODO: check success
-    }
-            
-    ref_index = (x - ref + iter->cyclic_buffer_size) % iter->cyclic_buffer_size;
-    // TODO: check for valid reference
-    if (ref > 0)
-    {
-        if ( (block_count = read_block_count(g, bf)) != 0 ) {
-            // TODO: test success
-            int_vector_ensure_size(&iter->block, block_count);
-        }
-
-        TRACE((DEBUG_DEEP, "block_count = %"PRINTF_INT64_MODIFIER"\n", block_count));
-    
-        // the number of successors copied, and the total number of successors specified
-        // in some copy
-        copied = 0; 
-        total = 0;
-
-        for (i = 0; i < block_count; i++) {
-            iter->block.a[i] = read_block(g, bf) + (i == 0 ? 0 : 1);
-            // TODO: test success
-            total += iter->block.a[i];
-            if (i % 2 == 0) {
-                copied += iter->block.a[i];
-            }
+    rval = bvgraph_nonzero_iterator(g, &iter);
+    if (rval) { free(rowstart); int_vector_free(&links); return rval; }
+    rval = bvgraph_iterator_seek(&iter, start);
+    rowstart[0] = 0;
+    for (x = start; x < end && rval == 0; x++) {
+        uint64_t d, nz;
+        if (x > start) { rval = bvgraph_iterator_next(&iter); }
+        if (rval) { break; }
+        d = (uint64_t)iter.curr_outd;
+        nz = rowstart[x - first];
+        if (nz + d > links.elements) {
+            rval = int_vector_ensure_size(&links, 
+                nz + d > 2*links.elements ? nz + d : 2*links.elements);
+            if (rval) { break; }
         }
-        if (block_count%2 == 0) {
-            copied += (iter->outd_cache[ref_index] - total);
+        if (d > 0) {
+            memcpy(&links.a[nz], iter.window[x % iter.cyclic_buffer_size].a, 
+                sizeof(int64_t)*d);
         }
-        // TODO: error on copied > d
-        extra_count = d - copied;
-
-    }
-    else {
-        extra_count = d;
-    }
-            
-    interval_count = 0;
-    if (extra_count > 0)
-    {
-        if (g->min_interval_length != 0 && (interval_count = bitfile_read_gamma(bf)) != 0) 
-        {
-            int64_t prev = 0;
-
-            // TODO: test success
-            int_vector_ensure_size(&iter->left, interval_count);
-            int_vector_ensure_size(&iter->len, interval_count);
-            
-            // now read the intervals
-            iter->left.a[0] = prev = nat2int(bitfile_read_gamma(bf)) + x;
-            iter->len.a[0] = bitfile_read_gamma(bf) + g->min_interval_length;
-
-            prev += iter->len.a[0];
-            extra_count -= iter->len.a[0];
-            
-            for (i=1; i < interval_count; i++) {
-                iter->left.a[i] = prev = bitfile_read_gamma(bf) + prev + 1;
-                iter->len.a[i] = bitfile_read_gamma(bf) + g->min_interval_length;
-                prev += iter->len.a[i];
-                extra_count -= iter->len.a[i];
-            }
+        rowstart[x - first + 1] = nz + d;
+        if (x - first + 1 == batch || x + 1 == end) {
+            rval = visit(ctx, first, x - first + 1, rowstart, links.a);
+            first = x + 1;
         }
     }
-        
-    buf1_index = 0;
-    buf2_index = 0;
-
-    TRACE((DEBUG_DEEP, 
-        "extra_count = %"PRINTF_INT64_MODIFIER"\n"
-        "interval_count = %"PRINTF_INT64_MODIFIER"\n"
-        "ref = %"PRINTF_INT64_MODIFIER"\n",
-         extra_count, interval_count, ref));
-
-    // read the residuals into a buffer
-    {
-        int64_t prev = -1;
-        int64_t residual_count = extra_count;
-        while (residual_count > 0) {
-            residual_count--;
-            if (prev == -1) { iter->buf1.a[buf1_index++] = prev = x + nat2int(read_residual(g, bf)); }
-            else { iter->buf1.a[buf1_index++] = prev = read_residual(g, bf) + prev + 1; }
-        }
+    bvgraph_iterator_free(&iter);
+    int_vector_free(&links);
+    free(rowstart);
+    return (rval);
+}
+
+/** The number of nodes in each chunk of an async iterator */
+#define ASYNC_CHUNK_NODES 4096
+
+/** The state of an async iterator, shared with its helper thread.
+ *
+ * The chunks ring[head] to ring[head+ready-1] are decoded, and the first
+ * of them is the one the caller is reading.  The helper thread fills 
+ * ring[tail] while ready < depth.
+ */
+struct async_state {
+    bvgraph_iterator iter;  ///< the decoder, only used by the helper
+    bvgraph_csr_chunk *ring;
+    uint64_t *links_size;   ///< the size of the links array of each chunk
+    int depth;
+    int head, tail, ready;
+    int done;               ///< the helper decoded the last chunk
+    int stop;               ///< the caller asked the helper to stop
+    int rval;               ///< the error from the helper
+#ifdef HAVE_PTHREADS
+    int started;            ///< the helper thread is running
+    pthread_t thread;
+    pthread_mutex_t lock;
+    pthread_cond_t filled, emptied;
+#endif
+};
+
+/** Decode the next chunk of an async iterator into ring[tail].
+ *
+ * The links array grows when a node does not fit.
+ * @return 0 on success
+ */
+static int async_fill(struct async_state *s)
+{
+    bvgraph_csr_chunk *c = &s->ring[s->tail];
+    int rval;
+    while ((rval = bvgraph_iterator_next_batch(&s->iter, ASYNC_CHUNK_NODES,
+                s->links_size[s->tail], c)) == bvgraph_call_buffer_too_small) {
+        uint64_t size = 2*s->links_size[s->tail];
+        int64_t *links;
+        if (size < (uint64_t)s->iter.curr_outd) { size = (uint64_t)s->iter.curr_outd; }
+        links = realloc(c->links, sizeof(int64_t)*size);
+        if (!links) { return bvgraph_call_out_of_memory; }
+        c->links = links;
+        s->links_size[s->tail] = size;
     }
-                
-    if (interval_count == 0)
-    {
-        // don't do anything
-    }
-    else
-    {
-        // copy the extra interval data
-        for (i = 0; i < interval_count; i++)
-        {
-            int64_t j, cur_left = iter->left.a[i];
-            for (j = 0; j < iter->len.a[i]; j++) {
-                iter->buf2.a[buf2_index++] = cur_left + j;
-            }
-        }
+    return (rval);
+}
 
-        if (extra_count > 0)
-        {
-            // merge buf1, buf2 into arcs
-            merge_int_arrays(iter->buf1.a, buf1_index, iter->buf2.a, buf2_index, 
-                iter->successors.a, iter->successors.elements);
-            
-            // now copy arcs back to buffer1, and free buffer2
-            buf1_index = buf1_index + buf2_index;
-            buf2_index = 0;           
-            memcpy(iter->buf1.a, iter->successors.a, buf1_index*sizeof(int64_t));
+#ifdef HAVE_PTHREADS
+/** The helper thread of an async iterator */
+static void* async_decode(void *arg)
+{
+    struct async_state *s = arg;
+    for (;;) {
+        int rval;
+        pthread_mutex_lock(&s->lock);
+        while (s->ready == s->depth && !s->stop) {
+            pthread_cond_wait(&s->emptied, &s->lock);
         }
-        else
-        {
-            memcpy(iter->buf1.a, iter->buf2.a, buf2_index*sizeof(int64_t));
-            buf1_index = buf2_index;
-            buf2_index = 0;
+        if (s->stop) { pthread_mutex_unlock(&s->lock); break; }
+        pthread_mutex_unlock(&s->lock);
+
+        // the chunk at tail is not visible to the caller until ready grows
+        rval = async_fill(s);
+
+        pthread_mutex_lock(&s->lock);
+        if (rval || s->ring[s->tail].nodes == 0) {
+            s->rval = rval;
+            s->done = 1;
+        } else {
+            s->tail = (s->tail + 1) % s->depth;
+            s->ready++;
         }
+        pthread_cond_signal(&s->filled);
+        pthread_mutex_unlock(&s->lock);
+        if (s->done) { break; }
+    }
+    return (NULL);
+}
+#endif /* HAVE_PTHREADS */
+
+/** Wait for the chunk at head and make it current.
+ * @return 0 on success
+ */
+static int async_acquire(bvgraph_async_iterator *i)
+{
+    struct async_state *s = i->state;
+    int rval;
+#ifdef HAVE_PTHREADS
+    pthread_mutex_lock(&s->lock);
+    while (s->ready == 0 && !s->done) {
+        pthread_cond_wait(&s->filled, &s->lock);
+    }
+#else
+    // without threads, decode the chunk now
+    if (s->ready == 0 && !s->done) {
+        s->rval = async_fill(s);
+        if (s->rval || s->ring[s->tail].nodes == 0) { s->done = 1; }
+        else { s->tail = (s->tail + 1) % s->depth; s->ready++; }
+    }
+#endif
+    // an error only shows once the chunks before it are used
+    rval = s->ready > 0 ? 0 : s->rval;
+    if (s->ready > 0) {
+        i->chunk = &s->ring[s->head];
+        i->chunk_index = 0;
+        i->curr = i->chunk->first;
+        i->curr_outd = (int64_t)(i->chunk->rowstart[1] - i->chunk->rowstart[0]);
+    } else {
+        // the end of the graph, or an error
+        i->chunk = NULL;
+        i->chunk_index = 0;
+        i->curr = i->g->n;
+        i->curr_outd = 0;
     }
+#ifdef HAVE_PTHREADS
+    pthread_mutex_unlock(&s->lock);
+#endif
+    return (rval);
+}
+
+/** Give the current chunk back to the helper thread. */
+static void async_release(bvgraph_async_iterator *i)
+{
+    struct async_state *s = i->state;
+#ifdef HAVE_PTHREADS
+    pthread_mutex_lock(&s->lock);
+#endif
+    s->head = (s->head + 1) % s->depth;
+    s->ready--;
+#ifdef HAVE_PTHREADS
+    pthread_cond_signal(&s->emptied);
+    pthread_mutex_unlock(&s->lock);
+#endif
+    i->chunk = NULL;
+}
+
+/**
+ * Create an iterator that decodes the graph on a helper thread.
+ *
+ * The iterator works like a nonzero iterator: it starts at node 0 and 
+ * moves with bvgraph_async_iterator_next.  The helper thread keeps up
+ * to depth chunks of decoded successors ahead of the caller, so a depth
+ * of 2 already overlaps decoding with the work on the current chunk.
+ * Without thread support, each chunk is decoded when the caller needs it.
+ *
+ * @param[in] g the graph
+ * @param[in] i the iterator
+ * @param[in] depth the number of chunks in the ring, at least 1
+ * @return 0 on success
+ */
+int bvgraph_async_nonzero_iterator(bvgraph* g, bvgraph_async_iterator *i, int depth)
+{
+    struct async_state *s;
+    int rval, k;
+    uint64_t links_size = g->max_outd > 16*ASYNC_CHUNK_NODES ? 
+        (uint64_t)g->max_outd : 16*ASYNC_CHUNK_NODES;
 
-    if (ref <= 0)
-    {
-        // don't do anything except copy
-        // the data to arcs
-        if (interval_count == 0 || extra_count == 0) {
-            memcpy(iter->successors.a, iter->buf1.a, sizeof(int64_t)*buf1_index);
+    if (depth < 1) { return bvgraph_call_unsupported; }
+
+    i->g = g;
+    i->chunk = NULL;
+    i->state = s = calloc(1, sizeof(struct async_state));
+    if (!s) { return bvgraph_call_out_of_memory; }
+    s->depth = depth;
+    s->ring = calloc(depth, sizeof(bvgraph_csr_chunk));
+    s->links_size = calloc(depth, sizeof(uint64_t));
+    rval = (s->ring && s->links_size) ? 0 : bvgraph_call_out_of_memory;
+    for (k = 0; k < depth && rval == 0; k++) {
+        s->ring[k].rowstart = malloc(sizeof(uint64_t)*(ASYNC_CHUNK_NODES+1));
+        s->ring[k].links = malloc(sizeof(int64_t)*links_size);
+        s->links_size[k] = links_size;
+        if (!s->ring[k].rowstart || !s->ring[k].links) { 
+            rval = bvgraph_call_out_of_memory; 
         }
     }
-    else
-    {          
-        // TODO clean this code up          
-        // copy the information from the masked iterator
-        
-        int64_t mask_index = 0;
-        // this variable is intended to shadow the vector len
-        int64_t len = 0;
-
-        for (i=0; i < iter->outd_cache[ref_index]; )
-        {
-            if (len <= 0)
-            {
-                if (block_count == mask_index) 
-                {
-                    if (block_count % 2 == 0) {
-                        len = iter->outd_cache[ref_index] - i;
-                    }
-                    else {
-                        break;
-                    }
-                }
-                else {
-                    if (mask_index % 2 == 0) { len = iter->block.a[mask_index++]; }
-                    else { i += iter->block.a[mask_index++]; continue; }
-                }
-                
-                // in the case that length is 0, we continue.
-                if (len == 0) { continue; }
-            }
-            iter->buf2.a[buf2_index++] = iter->window[ref_index].a[i];
-            len--;
-            i++;
+    if (rval == 0) { rval = bvgraph_nonzero_iterator(g, &s->iter); }
+    if (rval) {
+        for (k = 0; s->ring && k < depth; k++) {
+            free(s->ring[k].rowstart);
+            free(s->ring[k].links);
         }
-        
-        merge_int_arrays(iter->buf1.a, buf1_index, iter->buf2.a, buf2_index, 
-            iter->successors.a, iter->successors.elements);
-
-        buf1_index = buf1_index + buf2_index;
-        buf2_index = 0;
+        free(s->ring);
+        free(s->links_size);
+        free(s);
+        i->state = NULL;
+        return (rval);
     }
 
-    // update the window
-    {
-        int64_t curr_index = iter->curr % iter->cyclic_buffer_size;
-        int_vector_ensure_size(&iter->window[curr_index], d);
-        
-        // unwrap the buffered output
-        memcpy(iter->window[curr_index].a, iter->successors.a, sizeof(int64_t)*d);
+#ifdef HAVE_PTHREADS
+    pthread_mutex_init(&s->lock, NULL);
+    pthread_cond_init(&s->filled, NULL);
+    pthread_cond_init(&s->emptied, NULL);
+    if (pthread_create(&s->thread, NULL, async_decode, s) != 0) {
+        bvgraph_async_iterator_free(i);
+        return bvgraph_call_unsupported;
     }
+    s->started = 1;
+#endif
 
-    return (0);
+    return async_acquire(i);
 }
 
 /**
- * check if the iterator is valid
- * @param[in] i the bvgraph iterator
- * @return 1 if the iterator is still valid, 0 otherwise
+ * Get the successors of the current node of an async iterator.
+ *
+ * @param[in] i the iterator
+ * @param[out] start the successors, valid until the iterator moves
+ * @param[out] len outdegree
+ * @return 0 on success
  */
-int bvgraph_iterator_valid(bvgraph_iterator* i)
+int bvgraph_async_iterator_outedges(bvgraph_async_iterator* i, 
+                                    int64_t** start, uint64_t* len)
 {
-    if (i->g && i->curr < i->g->n) { return 1; }
+    if (start) { 
+        *start = i->chunk ? 
+            &i->chunk->links[i->chunk->rowstart[i->chunk_index]] : NULL;
+    }
+    if (len) { *len = (uint64_t)i->curr_outd; }
     return (0);
 }
 
 /**
- * free the bvgraph iterator
- * @param[in] iter the iterator
+ * Move an async iterator to the next node.
+ *
+ * @param[in] i the iterator
+ * @return 0 on success
+ */
+int bvgraph_async_iterator_next(bvgraph_async_iterator* i)
+{
+    if (!i->chunk) { return bvgraph_call_unsupported; }
+    if (++i->chunk_index < i->chunk->nodes) {
+        i->curr++;
+        i->curr_outd = (int64_t)(i->chunk->rowstart[i->chunk_index+1] - 
+            i->chunk->rowstart[i->chunk_index]);
+        return (0);
+    }
+    return bvgraph_async_iterator_next_chunk(i);
+}
+
+/**
+ * Move an async iterator to the first node of the next chunk.
+ *
+ * This routine lets a caller work through i->chunk on its own and then
+ * skip to the next one.
+ *
+ * @param[in] i the iterator
  * @return 0 on success
  */
+int bvgraph_async_iterator_next_chunk(bvgraph_async_iterator* i)
+{
+    if (!i->chunk) { return bvgraph_call_unsupported; }
+    async_release(i);
+    return async_acquire(i);
+}
 
-int bvgraph_iterator_free(bvgraph_iterator *iter)
+/**
+ * Test if an async iterator is at a node of the graph.
+ *
+ * @param[in] i the iterator
+ * @return 1 if the iterator is valid
+ */
+int bvgraph_async_iterator_valid(bvgraph_async_iterator* i)
 {
-    int i;
-    if (iter->g && iter->curr == iter->g->n) { 
-        iter->g->max_outd = iter->max_outd;
-    }
-    bitfile_close(&iter->bf);
-    if (iter->bf.f) { fclose(iter->bf.f); } 
-    free(iter->outd_cache);
-    int_vector_free(&iter->successors);
-    for (i=0; i < iter->cyclic_buffer_size; i++) {
-        int_vector_free(&iter->window[i]);
-    }
-    free(iter->window);
-    int_vector_free(&iter->block);
-    int_vector_free(&iter->left);
-    int_vector_free(&iter->len);
-    int_vector_free(&iter->buf1);
-    int_vector_free(&iter->buf2);
-    iter->g = NULL;
+    return (i->chunk != NULL && i->curr < i->g->n);
+}
+
+/**
+ * Stop the helper thread and release the memory of an async iterator.
+ *
+ * @param[in] i the iterator
+ * @return 0 on success
+ */
+int bvgraph_async_iterator_free(bvgraph_async_iterator *i)
+{
+    struct async_state *s = i->state;
+    int k;
+    if (!s) { return (0); }
+#ifdef HAVE_PTHREADS
+    if (s->started) {
+        pthread_mutex_lock(&s->lock);
+        s->stop = 1;
+        pthread_cond_signal(&s->emptied);
+        pthread_mutex_unlock(&s->lock);
+        pthread_join(s->thread, NULL);
+    }
+    pthread_cond_destroy(&s->filled);
+    pthread_cond_destroy(&s->emptied);
+    pthread_mutex_destroy(&s->lock);
+#endif
+    bvgraph_iterator_free(&s->iter);
+    for (k = 0; k < s->depth; k++) {
+        free(s->ring[k].rowstart);
+        free(s->ring[k].links);
+    }
+    free(s->ring);
+    free(s->links_size);
+    free(s);
+    i->state = NULL;
+    i->chunk = NULL;
     return (0);
 }
 
@@ -633,8 +862,6 @@ int bvgraph_iterator_copy(bvgraph_iterator *i, bvgraph_iterator *j)
                 rval = int_vector_create_copy(&i->block, &j->block);
                 rval |= int_vector_create_copy(&i->left, &j->left);
                 rval |= int_vector_create_copy(&i->len, &j->len);
-                rval |= int_vector_create_copy(&i->buf1, &j->buf1);
-                rval |= int_vector_create_copy(&i->buf2, &j->buf2);
                 
                 if (rval == 0) {
                     return (0);                
@@ -669,19 +896,19 @@ static int compute_avgbalance(bvgraph *g, int niters, int wnode, int wedge,
         long long *avgbalance)
 {
     int rval; 
-    uint64_t d;
     long long balance = 0;
-    bvgraph_iterator iter;
+    bvgraph_outdegree_iterator iter;
 
     if (!avgbalance) { return bvgraph_call_unsupported; /* TODO: better return */ }
 
-    rval = bvgraph_nonzero_iterator(g, &iter);
+    rval = bvgraph_outdegree_range_iterator(g, 0, g->n, &iter);
     if (!rval) {
-        for (; bvgraph_iterator_valid(&iter); bvgraph_iterator_next(&iter)) {
-            bvgraph_iterator_outedges(&iter, NULL, &d);
-            balance += wnode + wedge*d;
+        for (; bvgraph_outdegree_iterator_valid(&iter) && rval == 0; 
+             rval = bvgraph_outdegree_iterator_next(&iter)) {
+            balance += wnode + wedge*iter.curr_outd;
         }
-        bvgraph_iterator_free(&iter);
+        bvgraph_outdegree_iterator_free(&iter);
+        if (rval) { return (rval); }
 
         *avgbalance = (balance + niters-1)/niters; /* round by the ceil function */
 
@@ -778,6 +1005,61 @@ static int distribute_iters(bvgraph *g, bvgraph_parallel_iterators *pits,
     return (rval);
 }
 
+/** Distribute iterators with the same balance as distribute_iters, 
+ * but find the first node of each iterator with an outdegree scan and
+ * move the iterators there from the checkpoints of the graph, instead of
+ * decoding the whole graph.
+ * 
+ * This function will clean up all intermediate computations
+ * if it fails.
+ */
+static int seek_iters(bvgraph *g, bvgraph_parallel_iterators *pits,
+        int wnode, int wedge, long long avgbalance)
+{
+    int rval, nsteps = 0, iter = 0, k;
+    long long balance = 0;
+    int64_t *first;
+    bvgraph_outdegree_iterator oi;
+
+    first = malloc(sizeof(int64_t)*pits->niters);
+    if (!first) { return bvgraph_call_out_of_memory; }
+    rval = bvgraph_outdegree_range_iterator(g, 0, g->n, &oi);
+    if (rval) { free(first); return (rval); }
+    first[0] = 0;
+    for (; bvgraph_outdegree_iterator_valid(&oi) && rval == 0; 
+         rval = bvgraph_outdegree_iterator_next(&oi)) {
+        if (balance >= avgbalance && iter + 1 < pits->niters) {
+            pits->nsteps[iter++] = nsteps;
+            first[iter] = oi.curr;
+            nsteps = 0; balance = 0;
+        }
+        balance += wnode + wedge*oi.curr_outd;
+        nsteps++;
+    }
+    bvgraph_outdegree_iterator_free(&oi);
+    pits->nsteps[iter] = nsteps;
+
+    for (k = 0; k <= iter && rval == 0; k++) {
+        rval = bvgraph_nonzero_iterator(g, &pits->iters[k]);
+        if (rval == 0 && first[k] > 0) {
+            rval = bvgraph_iterator_seek(&pits->iters[k], first[k]);
+            if (rval) { bvgraph_iterator_free(&pits->iters[k]); }
+        }
+        if (rval == 0 && BVGRAPH_VERBOSE) {
+            fprintf(stdout, "iterator %3i starts at node %9lli with %9d steps\n",
+                k, (long long)first[k], pits->nsteps[k]);
+        }
+    }
+    free(first);
+    if (rval) {
+        // free the iterators before the one that failed
+        for (k -= 2; k >= 0; k--) { bvgraph_iterator_free(&pits->iters[k]); }
+        return (rval);
+    }
+    pits->niters = iter + 1;
+    return (0);
+}
+
 /** Construct independent iterators over portions of the graph.
  * 
  * These iterators are most often used to do parallel iteration 
@@ -788,6 +1070,10 @@ static int distribute_iters(bvgraph *g, bvgraph_parallel_iterators *pits,
  * 
  * For OpenMP tasks, wnode=0, wedge=1 is often a good choice.
  * For MPI taks, wnode=1, wedge=1 is often a good choice.
+ *
+ * With checkpoints from bvgraph_load_checkpoints, the iterators are 
+ * started from the checkpoints after a scan of the outdegrees, instead
+ * of copies made while decoding the whole graph.
  * 
  * @param[in] g the bvgraph
  * @param[out] pits an uninitialized bvgraph_parallel_iterators structure
@@ -815,7 +1101,12 @@ int bvgraph_parallel_iterators_create(bvgraph *g,
         if (pits->nsteps) {
             long long avgbalance=0;
             rval = compute_avgbalance(g, niters, wnode, wedge, &avgbalance);
-            if (!rval) {
+            if (!rval && g->checkpoints) {
+                rval = seek_iters(g, pits, wnode, wedge, avgbalance);
+                if (!rval) {
+                    return (0);
+                }
+            } else if (!rval) {
                 rval = distribute_iters(g, pits, wnode, wedge, avgbalance);
                 if (!rval) {
                     return (0);
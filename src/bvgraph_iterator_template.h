@@ -0,0 +1,441 @@
+/*
+ * David Gleich
+ * Copyright, Stanford University, 2026
+ * 17 October 2026
+ */
+
+/**
+ * @file bvgraph_iterator_template.h
+ * The sequential iterator routines, written once for each node id type.
+ *
+ * This file is included by bvgraph_iterator.c once for bvgraph_iterator 
+ * with int64_t node ids and once for bvgraph_iterator32 with uint32_t 
+ * node ids.  Before including it, define
+ *   BVG_NODE the node id type
+ *   BVG_NODE_MAX the largest node id
+ *   BVG_ITERATOR, BVG_VECTOR the iterator and vector types
+ *   BVG_VECTOR_CREATE, BVG_VECTOR_ENSURE, BVG_VECTOR_FREE the vector routines
+ *   BVG_CREATE, BVG_OUTEDGES, BVG_MERGE_SUCCESSORS, BVG_SWAP, BVG_NEXT, 
+ *   BVG_VALID, BVG_FREE the names of the routines to define.
+ * The file undefines all of them at the end, and so it has no include guard.
+ */
+
+/** History
+ *
+ * 2026-10-17: Initial version, moved from bvgraph_iterator.c
+ *             Merge the successors in one pass with BVG_MERGE_SUCCESSORS
+ *             instead of through buf1 and buf2
+ *             Moved merge_int_arrays to bvgraph_merge.c
+ */
+
+/**
+ * Create a non-zero iterator for the bvgraph.  The non-zero iterator is 
+ * a new object like structure that iterates over the successors of each node
+ * in the graph.  There can be many nonzero iterators and each nonzero iterator
+ * is independent.
+ *
+ * The nonzero iterator requires persistent memory to work and is useful
+ * for a single iteration over the file.  Each new iteration requires a new
+ * nonzero iterator at present.
+ *
+ * @param[in] g the graph
+ * @param[in] i the iterator
+ * @return 0 on success
+ */
+int BVG_CREATE(bvgraph* g, BVG_ITERATOR *i)
+{
+    int rval = 0;
+    int64_t outd_alloc = 10;
+    int windcount = 0;
+
+    // every node id must fit in the successor arrays
+    if (g->n > 0 && (uint64_t)g->n - 1 > (uint64_t)BVG_NODE_MAX) {
+        return bvgraph_call_unsupported;
+    }
+
+    // check and see if we know something better about the maximum outdegree
+    if (g->max_outd != 0) {
+        // if we set this variable, then we will avoid all
+        // reallocations as we pass through the file.  I'm not 
+        // sure if that is an issue, but it may be.
+        outd_alloc = g->max_outd;
+        i->max_outd = g->max_outd;
+    }
+    else {
+        i->max_outd = 0; 
+    }
+
+    i->g = g;
+    i->curr = -1;
+    i->curr_outd = -1;
+    i->cyclic_buffer_size = i->g->window_size+1;
+
+    if (g->offset_step == -1) {
+        char *graphfilename = strappend(g->filename, g->filenamelen, ".graph", 6);
+        FILE *f = fopen(graphfilename, "rb");
+        free(graphfilename);
+        if (!f) { return bvgraph_call_io_error; }
+
+        rval = bitfile_open(f,&i->bf);
+        if (rval) { return rval; }
+    } else if (g->offset_step >= 0) {
+        rval = bitfile_map(g->memory, g->memory_size, &i->bf);
+        if (g->memory_mapped) { fmapadvise(g->memory, g->memory_size, 0); }
+    } else {
+        return bvgraph_call_unsupported;
+    }
+
+    // beyond this point, the bitfile was successfully allocated, so we must 
+    // deallocate it if we exit.
+
+    i->outd_cache = malloc(sizeof(int64_t)*i->cyclic_buffer_size);
+    if (i->outd_cache) {
+        i->window = malloc(sizeof(BVG_VECTOR)*i->cyclic_buffer_size);
+        if (i->window) {
+            rval = BVG_VECTOR_CREATE(&i->successors, outd_alloc);
+            if (rval == 0) {
+                for (windcount = 0; windcount < i->cyclic_buffer_size; windcount++) {
+                    rval = BVG_VECTOR_CREATE(&i->window[windcount], outd_alloc);
+                    if (rval != 0) { break; }
+                }
+
+                // 
+                // this statement here indicates we should return
+                // with success and a correctly allocated 
+                // interator
+                //
+                
+                rval = int_vector_create(&i->block, outd_alloc);
+                rval = int_vector_create(&i->left, outd_alloc);
+                rval = int_vector_create(&i->len, outd_alloc);
+
+                if (rval == 0) { 
+                    rval = BVG_NEXT(i);
+                    if (rval == 0) {
+                        return (0); 
+                    }
+                    // we failed to fetch the first set of
+                    // indices, this indicates that we 
+                    // failed in creation and should free
+                    // ourselves
+                }
+
+                // in this case, we have to free everything allocated
+                while (windcount >= 0) {
+                    BVG_VECTOR_FREE(&i->window[windcount]);
+                    windcount--;
+                }
+
+                BVG_VECTOR_FREE(&i->successors);
+            }
+            free(i->window);
+        }
+        else { rval = bvgraph_call_out_of_memory; }
+
+        free(i->outd_cache);
+    } 
+    else { rval = bvgraph_call_out_of_memory; }
+    bitfile_close(&i->bf);
+    if (i->bf.f) { fclose(i->bf.f); } 
+  
+    return rval;
+}
+
+/**
+ * This routine provides access to the successors array stored inside
+ * the iterator, so the successor array will be invalidated after 
+ * a call to iterator_next.  The array is the current slot of the 
+ * iterator's window, so it is not copied.
+ * 08/28/11
+ * @param[out] start starting point of links (array)
+ * @param[out] len outdegree
+ * @return 0 on success
+ */
+int BVG_OUTEDGES(BVG_ITERATOR* i, BVG_NODE** start, uint64_t* len)
+{
+    if (start) { 
+        *start = i->curr >= 0 ? i->window[i->curr % i->cyclic_buffer_size].a : NULL; 
+    }
+    if (len) { *len = i->curr_outd; }
+
+    return (0);
+}
+
+/**
+ * Merge the copied, interval and residual successors of a node in a 
+ * single pass.  The copied successors are read from the reference list
+ * through its copy blocks, the intervals are expanded as they are merged,
+ * and the residuals are decoded from the stream as they are merged.
+ *
+ * <P><strong>Warning</strong>: this is the last step of reading a 
+ * successor list, bf must be just before the first residual.
+ *
+ * @param[in] g the graph
+ * @param[in] bf the graph stream, just before the first residual of x
+ * @param[in] x the node
+ * @param[in] d the outdegree of x
+ * @param[in] ref_links the successors of the reference, or NULL
+ * @param[in] outd_ref the outdegree of the reference, or 0
+ * @param[in] block the copy blocks
+ * @param[in] block_count the number of copy blocks, or 0 without a reference
+ * @param[in] left the first node of each interval
+ * @param[in] len the length of each interval
+ * @param[in] interval_count the number of intervals
+ * @param[in] residual_count the number of residuals
+ * @param[out] out the successors, an array of length d
+ */
+void BVG_MERGE_SUCCESSORS(bvgraph *g, bitfile *bf, int64_t x, int64_t d,
+    const BVG_NODE *ref_links, int64_t outd_ref,
+    const int64_t *block, int64_t block_count,
+    const int64_t *left, const int64_t *len, int64_t interval_count,
+    int64_t residual_count, BVG_NODE *out)
+{
+    // the next node from each part, or INT64_MAX when it is exhausted
+    int64_t copy, interval, residual;
+    int64_t k, ci, vi = 0, vj = 0;
+    struct copy_mask m;
+
+    copy_mask_init(&m, block, block_count, outd_ref);
+    ci = copy_mask_next(&m);
+    copy = ci >= 0 ? (int64_t)ref_links[ci] : INT64_MAX;
+    interval = interval_count > 0 ? left[0] : INT64_MAX;
+    residual = INT64_MAX;
+    if (residual_count > 0) {
+        residual = x + nat2int(read_residual(g, bf));
+        residual_count--;
+    }
+
+    for (k = 0; k < d; k++) {
+        if (copy < interval && copy < residual) {
+            out[k] = (BVG_NODE)copy;
+            ci = copy_mask_next(&m);
+            copy = ci >= 0 ? (int64_t)ref_links[ci] : INT64_MAX;
+        } else if (interval < residual) {
+            out[k] = (BVG_NODE)interval;
+            if (++vj < len[vi]) { interval++; }
+            else {
+                vj = 0;
+                interval = ++vi < interval_count ? left[vi] : INT64_MAX;
+            }
+        } else {
+            out[k] = (BVG_NODE)residual;
+            if (residual_count > 0) {
+                residual = read_residual(g, bf) + residual + 1;
+                residual_count--;
+            } else {
+                residual = INT64_MAX;
+            }
+        }
+    }
+}
+
+/**
+ * Swap the arrays of two vectors.
+ */
+static void BVG_SWAP(BVG_VECTOR *u, BVG_VECTOR *v)
+{
+    BVG_VECTOR tmp = *u;
+    *u = *v;
+    *v = tmp;
+}
+
+/**
+ * Load the next set of successors into the current slot of the window.  
+ * This routine invalidates the current set of successors.
+ *
+ * The copied, interval and residual successors are merged in a single 
+ * pass into i->successors, which is then swapped with the oldest slot 
+ * of the window, so no list is copied just to move it.
+ *
+ * @todo Optimize memory usage in this routine.
+ *
+ * @param[in] iter the iterator
+ * @return 0 on success
+ */
+int BVG_NEXT(BVG_ITERATOR* iter)
+{
+    const int64_t x = ++(iter->curr);
+    int64_t ref = 0, ref_index = 0;
+    int64_t i = 0, extra_count = 0, block_count = 0;
+
+    // TODO: make these static arrays for the iterator
+    // bvgraph_int_vector block, left, len, buf1, buf2;
+
+    bvgraph *g = iter->g;
+    bitfile *bf = &iter->bf;
+
+    int64_t d, copied, total, interval_count;
+
+    // make sure the iterator is still valid
+    if (!BVG_VALID(iter)) {
+        return bvgraph_call_unsupported;
+    }
+
+    d = iter->outd_cache[x%iter->cyclic_buffer_size]=read_outdegree(g, bf);
+    iter->curr_outd = d;
+
+    if (d > iter->max_outd) { iter->max_outd = d; }
+
+    if (d == 0) {
+        // nothing to do!
+        return (0);
+    }
+
+    // allocate the structures
+    // TODO perform error checking here
+    /*int_vector_create(&block, 10);
+    int_vector_create(&left, 10);
+    int_vector_create(&len, 10);
+
+    // allocate a sufficient buffer for the output
+    BVG_VECTOR_ENSURE(&iter->successors, d);
+    int_vector_create(&buf1, d);
+    int_vector_create(&buf2, d);*/
+
+    BVG_VECTOR_ENSURE(&iter->successors, d);
+
+    TRACE((DEBUG_DEEP, "** begin successors\ncurr = %"PRINTF_INT64_MODIFIER"\n"
+                            "d=%"PRINTF_INT64_MODIFIER"\n", 
+                            iter->curr, d));            
+    // we read the reference only if the actual window size is larger than one 
+    // (i.e., the one specified by the user is larger than 0).
+    if ( g->window_size > 0 ) {
+        ref = read_reference(g, bf);
+        // TODO: check success
+    }
+            
+    ref_index = (x - ref + iter->cyclic_buffer_size) % iter->cyclic_buffer_size;
+    // TODO: check for valid reference
+    if (ref > 0)
+    {
+        if ( (block_count = read_block_count(g, bf)) != 0 ) {
+            // TODO: test success
+            int_vector_ensure_size(&iter->block, block_count);
+        }
+
+        TRACE((DEBUG_DEEP, "block_count = %"PRINTF_INT64_MODIFIER"\n", block_count));
+    
+        // the number of successors copied, and the total number of successors specified
+        // in some copy
+        copied = 0; 
+        total = 0;
+
+        for (i = 0; i < block_count; i++) {
+            iter->block.a[i] = read_block(g, bf) + (i == 0 ? 0 : 1);
+            // TODO: test success
+            total += iter->block.a[i];
+            if (i % 2 == 0) {
+                copied += iter->block.a[i];
+            }
+        }
+        if (block_count%2 == 0) {
+            copied += (iter->outd_cache[ref_index] - total);
+        }
+        // TODO: error on copied > d
+        extra_count = d - copied;
+
+    }
+    else {
+        extra_count = d;
+    }
+            
+    interval_count = 0;
+    if (extra_count > 0)
+    {
+        if (g->min_interval_length != 0 && (interval_count = bitfile_read_gamma(bf)) != 0) 
+        {
+            int64_t prev = 0;
+
+            // TODO: test success
+            int_vector_ensure_size(&iter->left, interval_count);
+            int_vector_ensure_size(&iter->len, interval_count);
+            
+            // now read the intervals
+            iter->left.a[0] = prev = nat2int(bitfile_read_gamma(bf)) + x;
+            iter->len.a[0] = bitfile_read_gamma(bf) + g->min_interval_length;
+
+            prev += iter->len.a[0];
+            extra_count -= iter->len.a[0];
+            
+            for (i=1; i < interval_count; i++) {
+                iter->left.a[i] = prev = bitfile_read_gamma(bf) + prev + 1;
+                iter->len.a[i] = bitfile_read_gamma(bf) + g->min_interval_length;
+                prev += iter->len.a[i];
+                extra_count -= iter->len.a[i];
+            }
+        }
+    }
+        
+    TRACE((DEBUG_DEEP, 
+        "extra_count = %"PRINTF_INT64_MODIFIER"\n"
+        "interval_count = %"PRINTF_INT64_MODIFIER"\n"
+        "ref = %"PRINTF_INT64_MODIFIER"\n",
+         extra_count, interval_count, ref));
+
+    BVG_MERGE_SUCCESSORS(g, bf, x, d, 
+        ref > 0 ? iter->window[ref_index].a : NULL, 
+        ref > 0 ? iter->outd_cache[ref_index] : 0,
+        iter->block.a, ref > 0 ? block_count : 0, 
+        iter->left.a, iter->len.a, interval_count, extra_count, 
+        iter->successors.a);
+
+    // update the window by swapping the successors into the slot
+    // of the oldest node, whose array becomes the next spare
+    BVG_SWAP(&iter->window[iter->curr % iter->cyclic_buffer_size], 
+        &iter->successors);
+
+    return (0);
+}
+
+/**
+ * check if the iterator is valid
+ * @param[in] i the bvgraph iterator
+ * @return 1 if the iterator is still valid, 0 otherwise
+ */
+int BVG_VALID(BVG_ITERATOR* i)
+{
+    if (i->g && i->curr < i->g->n) { return 1; }
+    return (0);
+}
+
+/**
+ * free the bvgraph iterator
+ * @param[in] iter the iterator
+ * @return 0 on success
+ */
+
+int BVG_FREE(BVG_ITERATOR *iter)
+{
+    int i;
+    if (iter->g && iter->curr == iter->g->n) { 
+        iter->g->max_outd = iter->max_outd;
+    }
+    bitfile_close(&iter->bf);
+    if (iter->bf.f) { fclose(iter->bf.f); } 
+    free(iter->outd_cache);
+    BVG_VECTOR_FREE(&iter->successors);
+    for (i=0; i < iter->cyclic_buffer_size; i++) {
+        BVG_VECTOR_FREE(&iter->window[i]);
+    }
+    free(iter->window);
+    int_vector_free(&iter->block);
+    int_vector_free(&iter->left);
+    int_vector_free(&iter->len);
+    iter->g = NULL;
+    return (0);
+}
+
+#undef BVG_NODE
+#undef BVG_NODE_MAX
+#undef BVG_ITERATOR
+#undef BVG_VECTOR
+#undef BVG_VECTOR_CREATE
+#undef BVG_VECTOR_ENSURE
+#undef BVG_VECTOR_FREE
+#undef BVG_CREATE
+#undef BVG_OUTEDGES
+#undef BVG_MERGE_SUCCESSORS
+#undef BVG_SWAP
+#undef BVG_NEXT
+#undef BVG_VALID
+#undef BVG_FREE
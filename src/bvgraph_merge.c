@@ -0,0 +1,99 @@
+/*
+ * David Gleich
+ * Copyright, Stanford University, 2026
+ * 17 October 2026
+ */
+
+/**
+ * @file bvgraph_merge.c
+ * Merge sorted arrays of node ids with a branchless scalar loop.
+ *
+ * The iterators merge successor lists with merge_successors, in one pass
+ * over the copied, interval and residual parts, so these routines are only
+ * helpers for callers of the library.
+ *
+ * @version
+ *
+ * 2026-10-17: Initial version, moved merge_int_arrays from
+ *             bvgraph_iterator.c
+ *             Removed the AVX2 kernels, the iterators never call them
+ */
+
+#include "bvgraph_internal.h"
+
+/**
+ * Merge two sorted arrays without a branch on the comparison.
+ */
+static void merge64_scalar(const int64_t* a1, size_t a1len,
+                           const int64_t* a2, size_t a2len, int64_t *out)
+{
+    size_t a1i=0, a2i=0, oi=0;
+    while (a1i < a1len && a2i < a2len) {
+        int64_t x = a1[a1i], y = a2[a2i];
+        int take1 = x < y;
+        out[oi++] = take1 ? x : y;
+        a1i += take1;
+        a2i += 1 - take1;
+    }
+    if (a1i < a1len) {
+        memcpy(&out[oi], &a1[a1i], (a1len - a1i)*sizeof(int64_t));
+    } else {
+        memcpy(&out[oi], &a2[a2i], (a2len - a2i)*sizeof(int64_t));
+    }
+}
+
+/**
+ * The 32-bit version of merge64_scalar.
+ */
+static void merge32_scalar(const uint32_t* a1, size_t a1len,
+                           const uint32_t* a2, size_t a2len, uint32_t *out)
+{
+    size_t a1i=0, a2i=0, oi=0;
+    while (a1i < a1len && a2i < a2len) {
+        uint32_t x = a1[a1i], y = a2[a2i];
+        int take1 = x < y;
+        out[oi++] = take1 ? x : y;
+        a1i += take1;
+        a2i += 1 - take1;
+    }
+    if (a1i < a1len) {
+        memcpy(&out[oi], &a1[a1i], (a1len - a1i)*sizeof(uint32_t));
+    } else {
+        memcpy(&out[oi], &a2[a2i], (a2len - a2i)*sizeof(uint32_t));
+    }
+}
+
+/**
+ * Merge two sorted arrays into a single sorted array.
+ *
+ * @param[in] a1 the first array
+ * @param[in] a1len the length of the first array
+ * @param[in] a2 the second array
+ * @param[in] a2len the length of the second array
+ * @param[out] out the final array
+ * @param[out] outlen the length of the output array
+ * @return 0 on success
+ */
+int merge_int_arrays(const int64_t* a1, size_t a1len, const int64_t* a2,
+                     size_t a2len, int64_t *out, size_t outlen)
+{
+    // make sure we don't have to worry about having enough space
+    if (outlen < a1len + a2len) {
+        return bvgraph_call_unsupported;
+    }
+    merge64_scalar(a1, a1len, a2, a2len, out);
+    return (0);
+}
+
+/**
+ * The 32-bit version of merge_int_arrays.
+ */
+int merge_int32_arrays(const uint32_t* a1, size_t a1len, const uint32_t* a2,
+                       size_t a2len, uint32_t *out, size_t outlen)
+{
+    if (outlen < a1len + a2len) {
+        return bvgraph_call_unsupported;
+    }
+    merge32_scalar(a1, a1len, a2, a2len, out);
+    return (0);
+}
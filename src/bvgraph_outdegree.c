@@ -0,0 +1,265 @@
+/*
+ * David Gleich
+ * Copyright, Stanford University, 2026
+ * 17 October 2026
+ */
+
+/**
+ * @file bvgraph_outdegree.c
+ * Scan the outdegrees of a graph without decoding its successors.
+ *
+ * With offsets for every node, the outdegree of a node is the first code
+ * at its offset.  Otherwise, the scan reads the outdegree of each node
+ * and skips its successor list with skip_successors, which only needs
+ * the outdegrees of the last window_size nodes.  A scan only reads the
+ * graph, so scans over disjoint ranges can run on separate threads.
+ *
+ * @version
+ *
+ * 2026-10-17: Initial version
+ */
+
+#include "bvgraph_internal.h"
+#include "bvgraph_inline_io.h"
+
+/** The outdegree of a reference for skip_successors during a scan.
+ *
+ * @param ctx the outdegree iterator
+ * @param y the reference
+ * @return the outdegree, or a negative error code
+ */
+static int64_t scan_outdegree(void *ctx, int64_t y)
+{
+    bvgraph_outdegree_iterator *i = (bvgraph_outdegree_iterator*)ctx;
+    uint64_t d;
+    int rval;
+    if (y >= i->walk_start) { return i->outd[y % i->cyclic_buffer_size]; }
+    // only a walk from a sampled offset has references before its start
+    if (!i->ri) {
+        i->ri = malloc(sizeof(bvgraph_random_iterator));
+        if (!i->ri) { return (bvgraph_call_out_of_memory); }
+        rval = bvgraph_random_access_iterator(i->g, i->ri);
+        if (rval) { free(i->ri); i->ri = NULL; return (rval); }
+    }
+    rval = bvgraph_random_outdegree(i->ri, y, &d);
+    if (rval) { return (rval); }
+    return ((int64_t)d);
+}
+
+/** Read the outdegree of the current node from the bitfile.
+ */
+static void read_curr_outdegree(bvgraph_outdegree_iterator *i)
+{
+    bvgraph *g = i->g;
+    if (i->walk_start < 0) {
+        bitfile_position(&i->bf, node_offset(g, i->curr));
+    }
+    i->curr_outd = read_outdegree(g, &i->bf);
+    if (i->outd) { i->outd[i->curr % i->cyclic_buffer_size] = i->curr_outd; }
+}
+
+/** Create an iterator over the outdegrees of the nodes start to end-1.
+ *
+ * The iterator uses, in order of preference, the outdegrees cached by
+ * bvgraph_cache_outdegrees, the offset of each node with offset_step 1,
+ * or a scan that skips successor lists from the nearest sampled offset
+ * (offset_step > 1) or from the first node (no offsets).  Without
+ * offsets, starting at a node other than 0 has to skip the nodes before
+ * it.
+ *
+ * After the call, i->curr is start and i->curr_outd is its outdegree.
+ *
+ * @param[in] g the graph
+ * @param[in] start the first node
+ * @param[in] end one past the last node, at most g->n
+ * @param[out] i the iterator
+ * @return 0 on success
+ */
+int bvgraph_outdegree_range_iterator(bvgraph *g, int64_t start, int64_t end,
+                                     bvgraph_outdegree_iterator *i)
+{
+    int rval = 0;
+
+    memset(i, 0, sizeof(bvgraph_outdegree_iterator));
+    if (start < 0 || start > end || end > g->n) {
+        return (bvgraph_vertex_out_of_range);
+    }
+    i->g = g;
+    i->curr = start;
+    i->end = end;
+    i->curr_outd = -1;
+    i->cyclic_buffer_size = g->window_size + 1;
+    if (start == end) { return (0); }
+
+    if (g->outdegrees) {
+        i->curr_outd = g->outdegrees[start];
+        return (0);
+    }
+
+    if (g->offset_step == -1) {
+        char *graphfilename = strappend(g->filename, g->filenamelen, ".graph", 6);
+        FILE *f = fopen(graphfilename, "rb");
+        free(graphfilename);
+        if (!f) { return bvgraph_call_io_error; }
+        rval = bitfile_open(f, &i->bf);
+        if (rval) { fclose(f); return rval; }
+    } else if (g->offset_step >= 0) {
+        rval = bitfile_map(g->memory, g->memory_size, &i->bf);
+        if (rval) { return rval; }
+    } else {
+        return bvgraph_call_unsupported;
+    }
+
+    if (g->offset_step == 1) {
+        i->walk_start = -1;
+        read_curr_outdegree(i);
+        return (0);
+    }
+
+    i->outd = malloc(sizeof(int64_t)*i->cyclic_buffer_size);
+    if (!i->outd) {
+        bvgraph_outdegree_iterator_free(i);
+        return (bvgraph_call_out_of_memory);
+    }
+    if (g->offset_step > 1) {
+        i->walk_start = start - start % g->offset_step;
+        bitfile_position(&i->bf, node_offset(g, i->walk_start));
+    } else {
+        i->walk_start = 0;
+    }
+    i->curr = i->walk_start;
+    read_curr_outdegree(i);
+    while (i->curr < start) {
+        rval = skip_successors(g, &i->bf, i->curr, (uint64_t)i->curr_outd,
+            scan_outdegree, i);
+        if (rval) {
+            bvgraph_outdegree_iterator_free(i);
+            return (rval);
+        }
+        i->curr++;
+        read_curr_outdegree(i);
+    }
+    return (0);
+}
+
+/** Move an outdegree iterator to the next node.
+ *
+ * @param[in] i the iterator
+ * @return 0 on success
+ */
+int bvgraph_outdegree_iterator_next(bvgraph_outdegree_iterator *i)
+{
+    int rval = 0;
+    if (i->curr >= i->end) { return (0); }
+    if (i->g->outdegrees) {
+        if (++i->curr < i->end) { i->curr_outd = i->g->outdegrees[i->curr]; }
+        return (0);
+    }
+    if (i->walk_start >= 0) {
+        rval = skip_successors(i->g, &i->bf, i->curr, (uint64_t)i->curr_outd,
+            scan_outdegree, i);
+        if (rval) { return (rval); }
+    }
+    if (++i->curr < i->end) { read_curr_outdegree(i); }
+    return (0);
+}
+
+/** Test if an outdegree iterator is on a node.
+ *
+ * @param[in] i the iterator
+ * @return 1 if i->curr is a node before the end of the iterator
+ */
+int bvgraph_outdegree_iterator_valid(bvgraph_outdegree_iterator *i)
+{
+    return (i->g != NULL && i->curr < i->end);
+}
+
+/** Release the memory of an outdegree iterator.
+ *
+ * @param[in] i the iterator
+ * @return 0 on success
+ */
+int bvgraph_outdegree_iterator_free(bvgraph_outdegree_iterator *i)
+{
+    bitfile_close(&i->bf);
+    if (i->bf.f) { fclose(i->bf.f); }
+    free(i->outd);
+    if (i->ri) { bvgraph_random_free(i->ri); free(i->ri); }
+    i->outd = NULL;
+    i->ri = NULL;
+    i->g = NULL;
+    return (0);
+}
+
+/** Write the outdegrees of the nodes start to end-1 to out.
+ *
+ * This call only reads the graph, so threads can fill disjoint ranges
+ * of one array at the same time.  Each range starts from its own offset
+ * when the graph has offsets.
+ *
+ * @param[in] g the graph
+ * @param[in] start the first node
+ * @param[in] end one past the last node, at most g->n
+ * @param[out] out the outdegrees, out[k] is the outdegree of start+k
+ * @return 0 on success
+ */
+int bvgraph_outdegrees_range(bvgraph *g, int64_t start, int64_t end,
+                             int64_t *out)
+{
+    bvgraph_outdegree_iterator iter;
+    int rval;
+    if (g->outdegrees && start >= 0 && start <= end && end <= g->n) {
+        memcpy(out, &g->outdegrees[start], sizeof(int64_t)*(end - start));
+        return (0);
+    }
+    rval = bvgraph_outdegree_range_iterator(g, start, end, &iter);
+    if (rval) { return (rval); }
+    for (; bvgraph_outdegree_iterator_valid(&iter) && rval == 0;
+         rval = bvgraph_outdegree_iterator_next(&iter))
+    {
+        *(out++) = iter.curr_outd;
+    }
+    bvgraph_outdegree_iterator_free(&iter);
+    return (rval);
+}
+
+/** Write the outdegree of every node to out.
+ *
+ * @param[in] g the graph
+ * @param[out] out the outdegrees, an array of length g->n
+ * @return 0 on success
+ */
+int bvgraph_outdegrees(bvgraph *g, int64_t *out)
+{
+    return bvgraph_outdegrees_range(g, 0, g->n, out);
+}
+
+/** Compute the outdegrees of a graph once and keep them in g->outdegrees.
+ *
+ * Later outdegree scans, bvgraph_random_outdegree and bvgraph_outdegree
+ * read the cached array.  This call also sets g->max_outd.  It modifies
+ * the graph, so call it before sharing the graph between threads.
+ * bvgraph_close releases the cache.
+ *
+ * @param[in] g the graph
+ * @return 0 on success
+ */
+int bvgraph_cache_outdegrees(bvgraph *g)
+{
+    int64_t *outdegrees, x, max_outd = 0;
+    int rval;
+    if (g->outdegrees) { return (0); }
+    outdegrees = malloc(sizeof(int64_t)*(g->n > 0 ? g->n : 1));
+    if (!outdegrees) { return (bvgraph_call_out_of_memory); }
+    rval = bvgraph_outdegrees(g, outdegrees);
+    if (rval) {
+        free(outdegrees);
+        return (rval);
+    }
+    for (x = 0; x < g->n; x++) {
+        if (outdegrees[x] > max_outd) { max_outd = outdegrees[x]; }
+    }
+    g->max_outd = max_outd;
+    g->outdegrees = outdegrees;
+    return (0);
+}
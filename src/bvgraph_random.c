@@ -7,7 +7,7 @@
 /**
  * @file bvgraph_random.c
  * Implement the set of routines to work with the bvgraph 
- * with random access, but only when offset_step = 1
+ * with random access
  * @author David Gleich
  * @date 10 March 2008
  * @brief implementation of routines for bvgraph with random access
@@ -15,6 +15,24 @@
  * @version
  *
  * 2008-03-10: Coding started
+ * 2026-10-17: Look up offsets with node_offset for Elias-Fano offsets
+ *             Support offset_step > 1 with skip_node
+ *             Replaced skip_node with skip_successors from bvgraph_inline_io.h
+ *             Merge the successors in one pass with merge_successors
+ *             Read outdegrees from the outdegree cache of the graph
+ *             Resolve references with an iterative walk of the reference
+ *             chain into per-iterator buffers instead of recursion
+ *             Replaced the global CACHE with a bounded successor cache in
+ *             each random access iterator
+ *             Look up and add queries in the shared cache of the graph
+ *             Added bvgraph_random_successors_batch
+ *             Added bvgraph_has_arc
+ *             Walk into previous blocks with the preallocated earlier
+ *             outdegree windows of the iterator
+ *             Continue the last walk of a block for a later node of the
+ *             same block, and position at the nodes of its window
+ *             Return bvgraph_call_buffer_too_small from the batch
+ *             Added random_successors_unshared for bvgraph_iterator_seek
  */
 
 #include "bvgraph_internal.h"
@@ -22,35 +40,239 @@
 
 #include "debug.h"
 
-struct successor *CACHE = NULL;
+// the FNV hash mixes the bytes of an int64_t key well enough
+#define HASH_FUNCTION HASH_FNV
+#include "uthash.h"
+
+/** A successor list in the cache of a random access iterator.  The
+ * successors are stored in the same allocation, after the entry.
+ */
+struct bvgraph_cache_entry_tag {
+    int64_t x;          ///< the node, the key of the hash table
+    int64_t d;          ///< its outdegree
+    int64_t *a;         ///< its successors
+    int referenced;     ///< set when found, cleared by the clock hand
+    UT_hash_handle hh;
+};
+
+typedef struct bvgraph_cache_entry_tag cache_entry;
+
+/** The bytes of a cache entry with d successors */
+static size_t cache_entry_bytes(int64_t d)
+{
+    return sizeof(cache_entry) + sizeof(int64_t)*(size_t)d;
+}
+
+/** Look up the successors of a node in a cache, and count the lookup.
+ *
+ * @param c the cache
+ * @param x the node
+ * @return the entry, or NULL
+ */
+static cache_entry* cache_find(bvgraph_successor_cache *c, int64_t x)
+{
+    cache_entry *e = NULL;
+    if (c->budget == 0) { return (NULL); }
+    HASH_FIND(hh, c->entries, &x, sizeof(int64_t), e);
+    if (e) {
+        e->referenced = 1;
+        c->hits++;
+    } else {
+        c->misses++;
+    }
+    return (e);
+}
+
+/** Evict entries with the CLOCK algorithm until bytes more fit in the
+ * budget of a cache.
+ *
+ * @param c the cache
+ * @param bytes the bytes to make room for
+ */
+static void cache_evict(bvgraph_successor_cache *c, size_t bytes)
+{
+    while (c->entries && c->bytes + bytes > c->budget) {
+        cache_entry *e = c->hand ? c->hand : c->entries;
+        c->hand = (cache_entry*)e->hh.next;
+        if (e->referenced) {
+            e->referenced = 0;
+        } else {
+            HASH_DELETE(hh, c->entries, e);
+            c->bytes -= cache_entry_bytes(e->d);
+            free(e);
+        }
+    }
+    if (!c->entries) { c->hand = NULL; }
+}
+
+/** Add the successors of a node to a cache, unless they are larger than
+ * the budget.
+ *
+ * @param c the cache
+ * @param x the node, which is not in the cache
+ * @param d its outdegree
+ * @param a its successors
+ */
+static void cache_insert(bvgraph_successor_cache *c, int64_t x, int64_t d,
+                         const int64_t *a)
+{
+    size_t bytes = cache_entry_bytes(d);
+    cache_entry *e;
+    if (bytes > c->budget) { return; }
+    cache_evict(c, bytes);
+    e = malloc(bytes);
+    if (!e) { return; }
+    e->x = x;
+    e->d = d;
+    e->a = (int64_t*)(e + 1);
+    e->referenced = 0;
+    if (d > 0) { memcpy(e->a, a, sizeof(int64_t)*d); }
+    HASH_ADD(hh, c->entries, x, sizeof(int64_t), e);
+    c->bytes += bytes;
+}
 
 /** Declare static methods for this iterator
  */
 
-/** Skip the successors of a node (after the outdegree part).
+static int64_t walk_to_node(bvgraph_random_iterator *ri, bitfile *bf, 
+                            int64_t x, int64_t *outd, int64_t *pos,
+                            int64_t from);
+
+/** Remember the outdegree of a node decoded during a walk.
  *
- * <P>This method must be called with <code>ibs</code> positioned exactly at the
- * beginning of the successor list of node <code>x</code>, excluding the outdegree,
- * which must be provided in <code>outd</code>.
- * 
- * <P><strong>Warning</strong>: This method duplicates unavoidably part of the
- * logic of {@link #successors(int, InputBitStream, int[][], int[], int[])}; the
- * two methods must remain tightly coupled.
+ * @param ri the random access iterator
+ * @param x the node
+ * @param d the outdegree of x
+ */
+static void memo_outdegree(bvgraph_random_iterator *ri, int64_t x, int64_t d)
+{
+    int64_t *entry = &ri->outd_memo[2*(x & (OUTD_MEMO_SIZE-1))];
+    entry[0] = x;
+    entry[1] = d;
+}
+
+/** Add an earlier outdegree window to a random iterator, for walks into
+ * previous blocks nested deeper than the windows allocated so far.
  *
- * @param ri the random access iterator, with the bitfile positioned exactly
- *           at the start of the successor list
- * @param x the node for the successor list
- * @param outd the outdegree of node x
+ * @param ri the random access iterator
  * @return 0 on success
  */
+static int grow_earlier(bvgraph_random_iterator *ri)
+{
+    int64_t **windows = realloc(ri->earlier_outd, 
+        sizeof(int64_t*)*(ri->earlier_size + 1));
+    if (!windows) { return (bvgraph_call_out_of_memory); }
+    ri->earlier_outd = windows;
+    windows[ri->earlier_size] = malloc(sizeof(int64_t)*ri->cyclic_buffer_size);
+    if (!windows[ri->earlier_size]) { return (bvgraph_call_out_of_memory); }
+    ri->earlier_size++;
+    return (0);
+}
 
-/*
-static int skip_node(bvgraph_random_iterator *ri,
-                     int x, unsigned int d)
+/** Find the outdegree of a node before the offset the current walk 
+ * started from.  Unless the node is in the memo, this walks from the 
+ * node's own offset with a new bitfile and the next earlier outdegree
+ * window, so the current walk is undisturbed.
+ *
+ * @param ri the random access iterator
+ * @param x the node
+ * @return the outdegree, or a negative error code
+ */
+static int64_t earlier_outdegree(bvgraph_random_iterator *ri, int64_t x)
 {
-    return (bvgraph_call_unsupported);
+    bitfile bf;
+    int64_t d;
+    if (ri->g->outdegrees) { return ri->g->outdegrees[x]; }
+    if (ri->outd_memo[2*(x & (OUTD_MEMO_SIZE-1))] == x) {
+        return ri->outd_memo[2*(x & (OUTD_MEMO_SIZE-1)) + 1];
+    }
+    if (ri->earlier_depth == ri->earlier_size) {
+        int rval = grow_earlier(ri);
+        if (rval) { return (rval); }
+    }
+    bitfile_map(ri->g->memory, ri->g->memory_size, &bf);
+    ri->earlier_depth++;
+    d = walk_to_node(ri, &bf, x, ri->earlier_outd[ri->earlier_depth-1], 
+        NULL, -1);
+    ri->earlier_depth--;
+    bitfile_close(&bf);
+    return (d);
+}
+
+/** The state of a walk from a stored offset for the callback of 
+ * skip_successors.
+ */
+struct walk_state {
+    bvgraph_random_iterator *ri;
+    int64_t start; ///< the first node of the walk
+    int64_t *outd; ///< the outdegrees of the nodes since start, in a cyclic buffer
+};
+
+/** The outdegree of a reference for skip_successors during a walk.
+ *
+ * @param ctx the walk_state
+ * @param y the reference
+ * @return the outdegree, or a negative error code
+ */
+static int64_t walk_outdegree(void *ctx, int64_t y)
+{
+    struct walk_state *w = (struct walk_state*)ctx;
+    if (y >= w->start) { return w->outd[y % w->ri->cyclic_buffer_size]; }
+    return earlier_outdegree(w->ri, y);
+}
+
+/** Position a bitfile just after the outdegree of a node, which is 
+ * returned.  The bitfile starts at the nearest stored offset at or before
+ * the node, or continues an earlier walk of the same block, and skips the
+ * nodes in between.
+ *
+ * @param ri the random access iterator
+ * @param bf the bitfile to position
+ * @param x the index of the node
+ * @param outd a cyclic buffer of cyclic_buffer_size outdegrees for the walk
+ * @param pos a cyclic buffer for the bit position after each outdegree,
+ *        or NULL
+ * @param from a node of the block of x, before x, with bf just after its
+ *        outdegree and the outdegrees of its window in outd from the walk
+ *        that reached it, or -1 to start from the offset of the block
+ * @return the outdegree, or a negative error code
+ */
+static int64_t walk_to_node(bvgraph_random_iterator *ri, bitfile *bf, 
+                            int64_t x, int64_t *outd, int64_t *pos,
+                            int64_t from)
+{
+    bvgraph *g = ri->g;
+    int64_t y;
+    struct walk_state w;
+    int rval;
+    w.ri = ri;
+    w.start = x - x % ri->offset_step;
+    w.outd = outd;
+    if (from < 0) {
+        rval = bitfile_position(bf, node_offset(g, w.start));
+        y = w.start;
+    } else {
+        rval = skip_successors(g, bf, from, 
+            (uint64_t)outd[from % ri->cyclic_buffer_size], walk_outdegree, &w);
+        y = from + 1;
+    }
+    if (rval) { return (rval); }
+    for (; y < x; y++) {
+        int64_t d = read_outdegree(g, bf);
+        outd[y % ri->cyclic_buffer_size] = d;
+        if (pos) { pos[y % ri->cyclic_buffer_size] = bitfile_tell(bf); }
+        memo_outdegree(ri, y, d);
+        rval = skip_successors(g, bf, y, (uint64_t)d, walk_outdegree, &w);
+        if (rval) { return (rval); }
+    }
+    {
+        int64_t d = read_outdegree(g, bf);
+        outd[x % ri->cyclic_buffer_size] = d;
+        if (pos) { pos[x % ri->cyclic_buffer_size] = bitfile_tell(bf); }
+        memo_outdegree(ri, x, d);
+        return (d);
+    }
 }
-*/
 
 /** Positions the given input bit stream exactly before the successor list of the
  * given node, just after the outdegree, which is returned.  
@@ -68,13 +290,33 @@ static int position_bvgraph(bvgraph_random_iterator *ri, int64_t x, uint64_t *d)
     if (ri->offset_step <= 0) {
         return bvgraph_requires_offsets;
     } else if (ri->offset_step == 1) {
-        int rval = bitfile_position(&ri->bf, ri->g->offsets[x]);
+        int rval = bitfile_position(&ri->bf, node_offset(ri->g, x));
         if (rval == 0) {
             *d = read_outdegree(ri->g, &ri->bf);
         }
         return rval;
     } else {
-        return bvgraph_call_unsupported;
+        const int cbs = ri->cyclic_buffer_size;
+        int64_t outd, from = ri->walk_node;
+        if (from < 0 || 
+            from - from % ri->offset_step != x - x % ri->offset_step) {
+            from = -1;
+        } else if (x <= from && from - x < cbs) {
+            // x is in the window of the last walk, like a reference of it
+            int rval = bitfile_position(&ri->bf, ri->walk_pos[x % cbs]);
+            if (rval == 0) { *d = (uint64_t)ri->outd_cache[x % cbs]; }
+            return (rval);
+        } else if (x < from || 
+                   bitfile_position(&ri->bf, ri->walk_pos[from % cbs])) {
+            from = -1;
+        }
+        // otherwise continue the last walk if x is later in its block
+        ri->walk_node = -1;
+        outd = walk_to_node(ri, &ri->bf, x, ri->outd_cache, ri->walk_pos, from);
+        if (outd < 0) { return ((int)outd); }
+        ri->walk_node = x;
+        *d = (uint64_t)outd;
+        return (0);
     }
 }
 
@@ -95,300 +337,651 @@ int bvgraph_random_outdegree(bvgraph_random_iterator *ri,
         return (bvgraph_vertex_out_of_range);
     }
     
-    // TODO: always add outd_cache search
-    if (ri->offset_step <= 0) {
+    if (ri->g->outdegrees) {
+        *d = (uint64_t)ri->g->outdegrees[i];
+        return (0);
+    } else if (ri->offset_step <= 0) {
         return (bvgraph_requires_offsets);
     } else if (ri->offset_step == 1) {
-        bitfile_position(&ri->outd_bf, ri->g->offsets[i]);
+        bitfile_position(&ri->outd_bf, node_offset(ri->g, i));
         *d = read_outdegree(ri->g, &ri->outd_bf);
         return (0);
     } else {
-        // code for the case when offset_step > 1
-        // check if its in the outd cache
-        // if (i >= ri->cache_start && i < ri->outd_cache_end) {
-        //     *d = ri->outd_cache[i-ri->cache_start];
-        //     return (0);
-        // } else {
-        //     bitfile_position(&ri->outd_bf, ri->offsets[i/ri->offset_step]);
-        //     skip_outdegrees(ri->g, &ri->outd_bf, i%ri->offset_step);
-        //     *d = read_outdegree(ri->g, &ri->outd_bf);
-        //     return (0);
-        // }
-        return (bvgraph_call_unsupported);
+        // outdegrees are not stored consecutively, so we have to
+        // skip the successor lists from the nearest offset, unless the
+        // successors are in the cache
+        int64_t outd;
+        cache_entry *e = NULL;
+        if (ri->cache.budget > 0) {
+            HASH_FIND(hh, ri->cache.entries, &i, sizeof(int64_t), e);
+            if (e) { *d = (uint64_t)e->d; return (0); }
+        }
+        // this walk reuses outd_cache, so the walk of ri->bf cannot continue
+        ri->walk_node = -1;
+        outd = walk_to_node(ri, &ri->outd_bf, i, ri->outd_cache, NULL, -1);
+        if (outd < 0) { return ((int)outd); }
+        *d = (uint64_t)outd;
+        return (0);
     }
 }
 
-/** Access the successors of a vertex.
+/** Add levels to the reference chain of a random iterator, for chains
+ * deeper than the graph's max_ref_count.
  *
- * This operation is not thread-safe and heavily modifies the random access
- * iterator.  (Don't worry though, it doesn't touch the underlying graph, so 
- * please do use one random iterator for each thread in your code.)
- * 
- * @param[in] ri a random access iterator for the graph
- * @param[in] x the index of the node (i in [0,g->n-1])
- * @param[out] start a pointer to internal memory for an array of length
- *                   len for the successors.  DO NOT MODIFY THIS ARRAY.
- * @param[out] len the node degree.
+ * @param ri the random access iterator
  * @return 0 on success
  */
-int bvgraph_random_successors(bvgraph_random_iterator *ri, 
-                             int64_t x, int64_t** start, uint64_t *length)
+static int grow_chain(bvgraph_random_iterator *ri)
 {
-    if (x<0 || x >= ri->g->n) {
-        return (bvgraph_vertex_out_of_range);
+    int k, size = ri->chain_size > 0 ? 2*ri->chain_size : 4;
+    struct bvgraph_chain_level_tag *chain = realloc(ri->chain, 
+        sizeof(struct bvgraph_chain_level_tag)*size);
+    if (!chain) { return (bvgraph_call_out_of_memory); }
+    ri->chain = chain;
+    for (k = ri->chain_size; k < size; k++) {
+        if (int_vector_create(&chain[k].links, 10)) { break; }
     }
-    else if (ri->offset_step <= 0) {
-        return (bvgraph_requires_offsets);
-    } else {
-        int64_t ref, ref_index;
-        int64_t i, extra_count, block_count = 0;
-        bvgraph_int_vector *block = &ri->block, *left = &ri->left, 
-        *len = &ri->len;
-
-        bvgraph *g = ri->g;
-        bitfile *bf = &ri->bf;
-        
-        uint64_t d;     //degree
-        
-        int64_t* temp = NULL;
-        int64_t* ref_links = NULL;
-        uint64_t outd_ref = 0LL;
-
-        int64_t interval_count;
-        int64_t buf1_index, buf2_index;
-        int cyclic_buffer_size;
+    ri->chain_size = k;
+    return (k > 0 && k == size ? 0 : bvgraph_call_out_of_memory);
+}
 
+/** Walk the reference chain of a node.  Each level of ri->chain gets
+ * the node, its outdegree, its reference and the bit position after the 
+ * reference, so the chain is decoded without positioning at a node
+ * twice.  The walk stops at a node in the successor cache.
+ *
+ * @param ri the random access iterator
+ * @param x the node
+ * @return the number of levels, or a negative error code
+ */
+static int walk_chain(bvgraph_random_iterator *ri, int64_t x)
+{
+    bvgraph *g = ri->g;
+    int depth = 0, rval;
+    for (;;) {
+        struct bvgraph_chain_level_tag *l;
+        uint64_t d = 0;
+        if (depth == ri->chain_size) {
+            rval = grow_chain(ri);
+            if (rval) { return (rval); }
+        }
+        l = &ri->chain[depth++];
+        l->x = x;
+        l->ref = -1;
         {
-            int rval = position_bvgraph(ri, x, &d);
-            if (rval) {
-                return (rval);
+            cache_entry *e = cache_find(&ri->cache, x);
+            l->cached = e != NULL;
+            if (e) {
+                l->d = e->d;
+                l->a = e->a;
+                return (depth);
             }
         }
+        rval = position_bvgraph(ri, x, &d);
+        if (rval) { return (rval); }
+        l->d = (int64_t)d;
+        l->a = NULL;
+        if (d > 0 && g->window_size > 0) { l->ref = read_reference(g, &ri->bf); }
+        l->pos = bitfile_tell(&ri->bf);
+        if (l->ref <= 0) { return (depth); }
+        x -= l->ref;
+    }
+}
 
-        *length = d;
+/** Decode the successors of one level of the reference chain.
+ *
+ * <P><strong>Warning</strong>: This method duplicates unavoidably part of the
+ * logic of bvgraph_iterator_next and skip_successors; they must remain 
+ * tightly coupled.
+ *
+ * @param ri the random access iterator, with ri->bf just after the 
+ *        reference of the level
+ * @param l the level, with l->links large enough for l->d successors
+ * @param ref_links the successors of the reference, or NULL
+ * @param outd_ref the outdegree of the reference
+ * @return 0 on success
+ */
+static int decode_successors(bvgraph_random_iterator *ri, 
+                             struct bvgraph_chain_level_tag *l,
+                             const int64_t *ref_links, int64_t outd_ref)
+{
+    bvgraph *g = ri->g;
+    bitfile *bf = &ri->bf;
+    bvgraph_int_vector *block = &ri->block, *left = &ri->left, *len = &ri->len;
+    int64_t i, x = l->x, d = l->d, extra_count, block_count = 0;
+    int64_t interval_count = 0;
 
-        if (d == 0) { 
-            *start = NULL;
-            return (0);
+    if (l->ref > 0) {
+        // total number of successors copied and total number specified
+        int64_t copied = 0, total = 0;
+        if ((block_count = read_block_count(g, bf)) != 0 &&
+            int_vector_ensure_size(block, block_count)) {
+            return (bvgraph_call_out_of_memory);
         }
 
-        // read a reference only if the window is bigger than 0
-        if (g->window_size > 0) {
-            ref = read_reference(g, bf);
-        } else {
-            ref = -1;
+        TRACE((DEBUG_DEEP, "block_count = %"PRINTF_INT64_MODIFIER"\n", block_count));
+
+        for (i = 0; i < block_count; i++) {
+            block->a[i] = read_block(g, bf) + (i == 0 ? 0 : 1);
+            total += block->a[i];
+            if (i % 2 == 0) {
+                copied += block->a[i];
+            }
         }
-        
-        // get successors of referred node
-        if (ref > 0) {
-            // get the reference links first
-            bvgraph_random_successors(ri, x-ref, &temp, &outd_ref);
-
-            // copy the reference successors cause ri->successors.a might be cleared
-            ref_links = malloc(sizeof(int64_t)*outd_ref);
-            memcpy(ref_links, temp, sizeof(int64_t)*outd_ref);
-            
-            // re-assigned the original node and position to ri since ri has been changed
-            ri->curr = x;
-            position_bvgraph(ri, x, &d);
-            if (g->window_size > 0) { ref = read_reference(g, bf); } else { ref = -1; }
+        if (block_count%2 == 0) {
+            copied += (outd_ref - total);
         }
-        
-        cyclic_buffer_size = g->window_size + 1;
-        // in our case, window isn't set at all, so we need to use the position
-        // method to set the file pointer, this could modify ri itself.
-        // this step requires offsets
-        //
+        // TODO: error on copied > d
+        extra_count = d - copied;
+    } else {
+        extra_count = d;
+    }
 
-        ri->outd_cache[x%ri->cyclic_buffer_size] = d;
-        ri->curr_outd = d;
+    if (extra_count > 0 && g->min_interval_length != 0 && 
+        (interval_count = bitfile_read_gamma(bf)) != 0) 
+    {
+        int64_t prev = 0;
 
-        if (d > (unsigned)ri->max_outd) { ri->max_outd = d; }
+        if (int_vector_ensure_size(left, interval_count) ||
+            int_vector_ensure_size(len, interval_count)) {
+            return (bvgraph_call_out_of_memory);
+        }
+        
+        // now read the intervals
+        left->a[0] = prev = nat2int(bitfile_read_gamma(bf)) + x;
+        len->a[0] = bitfile_read_gamma(bf) + g->min_interval_length;
 
-        int_vector_ensure_size(&ri->successors, d);
-        int_vector_ensure_size(&ri->buf1, d);
-        int_vector_ensure_size(&ri->buf2, d);
+        prev += len->a[0];
+        extra_count -= len->a[0];
+        
+        for (i=1; i < interval_count; i++) {
+            left->a[i] = prev = bitfile_read_gamma(bf) + prev + 1;
+            len->a[i] = bitfile_read_gamma(bf) + g->min_interval_length;
+            prev += len->a[i];
+            extra_count -= len->a[i];
+        }
+    }
 
-        ref_index = (x-ref + cyclic_buffer_size)%(cyclic_buffer_size);
+    TRACE((DEBUG_DEEP, 
+        "extra_count = %"PRINTF_INT64_MODIFIER"\n"
+        "interval_count = %"PRINTF_INT64_MODIFIER"\n"
+        "ref = %"PRINTF_INT64_MODIFIER"\n",
+         extra_count, interval_count, l->ref));
 
-        if (ref > 0) {
-            // total number of successors copied and total number specified
-            int64_t copied, total; 
-            if ( (block_count = read_block_count(g, bf)) != 0 ) {
-                // TODO: test success
-                int_vector_ensure_size(&ri->block, block_count);
-            }
+    merge_successors(g, bf, x, d, ref_links, l->ref > 0 ? outd_ref : 0,
+        block->a, l->ref > 0 ? block_count : 0, left->a, len->a, interval_count,
+        extra_count, l->links.a);
+    l->a = l->links.a;
+    return (0);
+}
 
-            TRACE((DEBUG_DEEP, "block_count = %"PRINTF_INT64_MODIFIER"\n", block_count));
+/** Access the successors of a vertex, with or without a look up in the
+ * shared cache.  A list found in the shared cache is not decoded, so
+ * ri->bf is only left at the end of the successors of x without the look 
+ * up.
+ *
+ * @param[in] ri a random access iterator for the graph
+ * @param[in] x the index of the node (i in [0,g->n-1])
+ * @param[out] start the successors, as for bvgraph_random_successors
+ * @param[out] length the node degree
+ * @param[in] lookup 0 to decode x even if it is in the shared cache
+ * @return 0 on success
+ */
+static int random_successors(bvgraph_random_iterator *ri, int64_t x, 
+                             int64_t** start, uint64_t *length, int lookup)
+{
+    struct bvgraph_chain_level_tag *l;
+    int depth, k, rval = 0;
 
-            copied = 0; 
-            total = 0;
+    if (x<0 || x >= ri->g->n) {
+        return (bvgraph_vertex_out_of_range);
+    }
+    else if (ri->offset_step <= 0) {
+        return (bvgraph_requires_offsets);
+    }
 
-            for (i = 0; i < block_count; i++) {
-                block->a[i] = read_block(g, bf) + (i == 0 ? 0 : 1);
-                // TODO: test success
-                total += block->a[i];
-                if (i % 2 == 0) {
-                    copied += block->a[i];
-                }
+    // the successors of the last query are no longer needed
+    if (ri->shared) {
+        bvgraph_shared_list_release(ri->shared);
+        ri->shared = NULL;
+    }
+    if (lookup && ri->g->shared_cache) {
+        bvgraph_shared_list *list = shared_cache_find(ri->g->shared_cache, x);
+        if (list) {
+            ri->shared = list;
+            ri->curr = x;
+            ri->curr_outd = list->d;
+            if (list->d > ri->max_outd) { ri->max_outd = list->d; }
+            *length = (uint64_t)list->d;
+            if (start) {
+                *start = list->d > 0 ? (int64_t*)list->a : NULL;
             }
+            return (0);
+        }
+    }
+
+    depth = walk_chain(ri, x);
+    if (depth < 0) { return (depth); }
 
-            if (block_count%2 == 0) {
-                // TODO: add check for window
-                // TODO: test success
-                copied += (outd_ref - total);
-                ri->outd_cache[ref_index] = outd_ref;
+    // decode from the deepest reference up, so the successors of each
+    // reference are ready for the level above
+    for (k = depth - 1; k >= 0 && rval == 0; k--) {
+        l = &ri->chain[k];
+        if (l->cached || l->d == 0) { continue; }
+        rval = int_vector_ensure_size(&l->links, (uint64_t)l->d);
+        if (rval == 0) { rval = bitfile_position(&ri->bf, l->pos); }
+        if (rval == 0) {
+            if (l->ref > 0) {
+                rval = decode_successors(ri, l, l[1].a, l[1].d);
+            } else {
+                rval = decode_successors(ri, l, NULL, 0);
             }
-            // TODO: error on copied > d
-            extra_count = d - copied;
         }
-        else {
-            extra_count = d;
+    }
+    if (rval) { return (rval); }
+
+    // cache the decoded lists only now, as an eviction could release
+    // the cached list of a reference
+    if (ri->cache.budget > 0) {
+        for (k = 0; k < depth; k++) {
+            l = &ri->chain[k];
+            if (!l->cached) { cache_insert(&ri->cache, l->x, l->d, l->a); }
         }
+    }
 
-        interval_count = 0;
-        if (extra_count > 0)
-        {
-            if (g->min_interval_length != 0 && (interval_count = bitfile_read_gamma(bf)) != 0) 
-            {
-                int64_t prev = 0;
-
-                // TODO: test success
-                int_vector_ensure_size(left, interval_count);
-                int_vector_ensure_size(len, interval_count);
-                
-                // now read the intervals
-                left->a[0] = prev = nat2int(bitfile_read_gamma(bf)) + x;
-                len->a[0] = bitfile_read_gamma(bf) + g->min_interval_length;
-
-                prev += len->a[0];
-                extra_count -= len->a[0];
-                
-                for (i=1; i < interval_count; i++) {
-                    left->a[i] = prev = bitfile_read_gamma(bf) + prev + 1;
-                    len->a[i] = bitfile_read_gamma(bf) + g->min_interval_length;
-                    prev += len->a[i];
-                    extra_count -= len->a[i];
-                }
-            }
+    l = &ri->chain[0];
+    if (ri->g->shared_cache) {
+        ri->shared = shared_cache_insert(ri->g->shared_cache, x, l->d, l->a);
+    }
+    ri->curr = x;
+    ri->curr_outd = l->d;
+    if (l->d > ri->max_outd) { ri->max_outd = l->d; }
+
+    *length = (uint64_t)l->d;
+    if (start) {
+        *start = l->d > 0 ? l->a : NULL;
+    }
+    return (0);
+}
+
+/** Access the successors of a vertex.
+ *
+ * This operation is not thread-safe and heavily modifies the random access
+ * iterator.  (Don't worry though, it doesn't touch the underlying graph, so 
+ * please do use one random iterator for each thread in your code.)
+ *
+ * The reference chain of x is walked once, and then decoded from the 
+ * deepest reference up into the buffers of ri->chain, so a query does
+ * not allocate memory once the buffers are large enough.
+ * 
+ * @param[in] ri a random access iterator for the graph
+ * @param[in] x the index of the node (i in [0,g->n-1])
+ * @param[out] start a pointer to internal memory for an array of length
+ *                   len for the successors.  DO NOT MODIFY THIS ARRAY.
+ * @param[out] len the node degree.
+ * @return 0 on success
+ */
+int bvgraph_random_successors(bvgraph_random_iterator *ri, 
+                             int64_t x, int64_t** start, uint64_t *length)
+{
+    return (random_successors(ri, x, start, length, 1));
+}
+
+/** Access the successors of a vertex without looking it up in the shared
+ * cache, so ri->bf is left at the end of the successors of x unless x is
+ * in the own cache of ri.  bvgraph_iterator_seek continues a sequential
+ * iterator from there.
+ *
+ * @param[in] ri a random access iterator for the graph
+ * @param[in] x the index of the node (i in [0,g->n-1])
+ * @param[out] start the successors, as for bvgraph_random_successors
+ * @param[out] length the node degree
+ * @return 0 on success
+ */
+int random_successors_unshared(bvgraph_random_iterator *ri, int64_t x, 
+                               int64_t** start, uint64_t *length)
+{
+    return (random_successors(ri, x, start, length, 0));
+}
+
+/** A query of a batch, sorted by node */
+struct batch_query {
+    int64_t x;          ///< the node
+    size_t j;           ///< its index in the batch
+    uint64_t pos;       ///< the start of its successors in the staged lists
+    uint64_t d;         ///< its outdegree
+};
+
+/** The number of queries between a prefetch and its decode */
+#define BATCH_PREFETCH_DISTANCE 8
+
+/** The bits of a node sorted in each pass over a batch */
+#define BATCH_RADIX_BITS 11
+
+/** Sort the queries of a batch by node with a radix sort, which is 
+ * stable and much faster than qsort for large batches.
+ *
+ * @param q the queries
+ * @param tmp space for k queries
+ * @param k the number of queries
+ * @param n the number of nodes of the graph
+ * @return q or tmp, whichever holds the sorted queries
+ */
+static struct batch_query* sort_batch_queries(struct batch_query *q,
+                                              struct batch_query *tmp,
+                                              size_t k, int64_t n)
+{
+    size_t count[1 << BATCH_RADIX_BITS];
+    const uint64_t mask = (1 << BATCH_RADIX_BITS) - 1;
+    int shift = 0;
+    do {
+        struct batch_query *swap;
+        size_t s, sum = 0;
+        int b;
+        memset(count, 0, sizeof(count));
+        for (s = 0; s < k; s++) { count[((uint64_t)q[s].x >> shift) & mask]++; }
+        for (b = 0; b < (1 << BATCH_RADIX_BITS); b++) {
+            size_t c = count[b];
+            count[b] = sum;
+            sum += c;
         }
+        for (s = 0; s < k; s++) {
+            tmp[count[((uint64_t)q[s].x >> shift) & mask]++] = q[s];
+        }
+        swap = q; q = tmp; tmp = swap;
+        shift += BATCH_RADIX_BITS;
+    } while (shift < 64 && ((uint64_t)(n - 1) >> shift) > 0);
+    return (q);
+}
 
-        buf1_index = 0;
-        buf2_index = 0;
+/** Prefetch the start of the block with the offset of a node. */
+static void prefetch_node(bvgraph *g, int64_t x)
+{
+#if defined(__GNUC__)
+    if (g->memory) {
+        unsigned long long offset = node_offset(g, x - x % g->offset_step);
+        __builtin_prefetch(g->memory + (offset >> 3));
+    }
+#endif
+}
 
-        TRACE((DEBUG_DEEP, 
-            "extra_count = %"PRINTF_INT64_MODIFIER"\n"
-            "interval_count = %"PRINTF_INT64_MODIFIER"\n"
-            "ref = %"PRINTF_INT64_MODIFIER"\n",
-             extra_count, interval_count, ref));
+/** Access the successors of many vertices in one call.
+ *
+ * The queries are sorted by node, which is the order of the graph file,
+ * and decoded in that order, and the graph memory of later queries is
+ * prefetched.  With offset_step > 1, a query later in the sample block 
+ * of the previous one continues its walk instead of walking from the 
+ * offset of the block, and its references in the window of that walk
+ * are found without a walk.  A node queried more than once is decoded 
+ * once.  The results are then scattered back in the order of
+ * the queries: the successors of nodes[j] are 
+ * out->links[out->rowstart[j]] to out->links[out->rowstart[j+1]-1].
+ * out->first is 0 and out->nodes is k.
+ *
+ * @param[in] ri a random access iterator for the graph
+ * @param[in] nodes the nodes, in any order
+ * @param[in] k the number of nodes
+ * @param[in] max_edges the number of entries in out->links
+ * @param[in,out] out the chunk, with the arrays rowstart, of k+1 entries,
+ *                and links allocated by the caller
+ * @return 0 on success, bvgraph_call_buffer_too_small if the 
+ *         successors need more than max_edges entries; then out->edges
+ *         is the number needed
+ */
+int bvgraph_random_successors_batch(bvgraph_random_iterator *ri,
+                                    const int64_t *nodes, size_t k,
+                                    uint64_t max_edges, bvgraph_csr_chunk *out)
+{
+    struct batch_query *queries, *q;
+    bvgraph_int_vector staged = {0};
+    uint64_t len = 0;
+    size_t s;
+    int rval = 0;
 
-        
-        // read the residuals into a buffer
-        {
-            int64_t prev = -1;
-            int64_t residual_count = extra_count;
-            while (residual_count > 0) {
-                residual_count--;
-                if (prev == -1) { ri->buf1.a[buf1_index++] = prev = x + nat2int(read_residual(g, bf)); }
-                else { ri->buf1.a[buf1_index++] = prev = read_residual(g, bf) + prev + 1; }
-            }
+    for (s = 0; s < k; s++) {
+        if (nodes[s] < 0 || nodes[s] >= ri->g->n) {
+            return (bvgraph_vertex_out_of_range);
         }
+    }
+    if (ri->offset_step <= 0) { return (bvgraph_requires_offsets); }
+    out->first = 0;
+    out->nodes = 0;
+    out->edges = 0;
+    out->rowstart[0] = 0;
+    if (k == 0) { return (0); }
 
-        if (interval_count == 0) {
-            // don't do anything
+    queries = malloc(sizeof(struct batch_query)*2*k);
+    if (!queries) { return (bvgraph_call_out_of_memory); }
+    for (s = 0; s < k; s++) {
+        queries[s].x = nodes[s];
+        queries[s].j = s;
+    }
+    q = sort_batch_queries(queries, queries + k, k, ri->g->n);
+
+    for (s = 0; s < BATCH_PREFETCH_DISTANCE && s < k; s++) {
+        prefetch_node(ri->g, q[s].x);
+    }
+    for (s = 0; s < k && rval == 0; s++) {
+        int64_t *links;
+        uint64_t d;
+        if (s > 0 && q[s].x == q[s-1].x) {
+            q[s].pos = q[s-1].pos;
+            q[s].d = q[s-1].d;
+            continue;
         }
-        else
-        {
-            // copy the extra interval data
-            for (i = 0; i < interval_count; i++)
-            {
-                int64_t j, cur_left = ri->left.a[i];
-                for (j = 0; j < ri->len.a[i]; j++) {
-                    ri->buf2.a[buf2_index++] = cur_left + j;
+        if (s + BATCH_PREFETCH_DISTANCE < k) {
+            prefetch_node(ri->g, q[s + BATCH_PREFETCH_DISTANCE].x);
+        }
+        rval = bvgraph_random_successors(ri, q[s].x, &links, &d);
+        if (rval) { break; }
+        if (len + d > staged.elements) {
+            uint64_t size = 2*staged.elements;
+            if (size < len + d) { size = len + d; }
+            rval = int_vector_ensure_size(&staged, size);
+            if (rval) { break; }
+        }
+        if (d > 0) { memcpy(&staged.a[len], links, sizeof(int64_t)*d); }
+        q[s].pos = len;
+        q[s].d = d;
+        len += d;
+    }
+
+    if (rval == 0) {
+        for (s = 0; s < k; s++) { out->rowstart[q[s].j + 1] = q[s].d; }
+        for (s = 0; s < k; s++) { out->rowstart[s + 1] += out->rowstart[s]; }
+        out->edges = out->rowstart[k];
+        if (out->edges > max_edges) {
+            rval = bvgraph_call_buffer_too_small;
+        } else {
+            for (s = 0; s < k; s++) {
+                if (q[s].d > 0) {
+                    memcpy(&out->links[out->rowstart[q[s].j]], &staged.a[q[s].pos],
+                        sizeof(int64_t)*q[s].d);
                 }
             }
-            
-            if (extra_count > 0)
-            {
-                // merge buf1, buf2 into arcs
-                merge_int_arrays(ri->buf1.a, buf1_index, ri->buf2.a, buf2_index, 
-                    ri->successors.a, ri->successors.elements);
-
-                // now copy arcs back to buffer1, and free buffer2
-                buf1_index = buf1_index + buf2_index;
-                buf2_index = 0;           
-                memcpy(ri->buf1.a, ri->successors.a, buf1_index*sizeof(int64_t));
-            }
-            else
-            {
-                memcpy(ri->buf1.a, ri->buf2.a, buf2_index*sizeof(int64_t));
-                buf1_index = buf2_index;
-                buf2_index = 0;
-            }
+            out->nodes = (int64_t)k;
         }
+    }
+    int_vector_free(&staged);
+    free(queries);
+    return (rval);
+}
 
-        if (ref <= 0)
-        {
-            // don't do anything except copy
-            // the data to arcs
-            if (interval_count == 0 || extra_count == 0) {
-                memcpy(ri->successors.a, ri->buf1.a, sizeof(int64_t)*buf1_index);
-            }
+/** Find a node in a sorted successor list.
+ *
+ * @param a the list
+ * @param d its length
+ * @param y the node
+ * @return the index of y, or -1 if it is not in the list
+ */
+static int64_t find_successor(const int64_t *a, int64_t d, int64_t y)
+{
+    int64_t lo = 0, hi = d;
+    while (lo < hi) {
+        int64_t mid = lo + (hi - lo)/2;
+        if (a[mid] < y) { lo = mid + 1; }
+        else { hi = mid; }
+    }
+    return (lo < d && a[lo] == y ? lo : -1);
+}
+
+/** Test if the copy blocks of a node copy a successor of its reference.
+ *
+ * @param g the graph
+ * @param bf the bitfile, just after the reference of the node
+ * @param k the index of the successor in the list of the reference
+ * @return 1 if the successor is copied, 0 otherwise
+ */
+static int block_copies(bvgraph *g, bitfile *bf, int64_t k)
+{
+    int64_t i, start = 0, block_count = read_block_count(g, bf);
+    for (i = 0; i < block_count; i++) {
+        start += read_block(g, bf) + (i == 0 ? 0 : 1);
+        if (k < start) { return (i % 2 == 0); }
+    }
+    // the successors after the last block are copied if it was skipped
+    return (block_count % 2 == 0);
+}
+
+/** Test if the graph has an arc from x to y.
+ *
+ * The successor list of x is not materialized.  The test reads the 
+ * list of x in the order of the graph file: it checks y against each 
+ * interval, then reads the residuals until one passes y, and only then
+ * decodes the reference of x to test the copied successors.  A list in
+ * the successor cache of the iterator or in the shared cache of the 
+ * graph is searched instead.
+ *
+ * Like bvgraph_random_successors, this call modifies the iterator.
+ *
+ * @param[in] ri a random access iterator for the graph
+ * @param[in] x the source node
+ * @param[in] y the target node
+ * @param[out] arc 1 if the arc exists, 0 otherwise
+ * @return 0 on success
+ */
+int bvgraph_has_arc(bvgraph_random_iterator *ri, int64_t x, int64_t y, int *arc)
+{
+    bvgraph *g = ri->g;
+    bitfile *bf = &ri->bf;
+    int64_t i, ref = -1, copied = 0, extra_count, interval_count;
+    long long pos;
+    uint64_t d;
+    int rval;
+
+    *arc = 0;
+    if (x < 0 || x >= g->n || y < 0 || y >= g->n) {
+        return (bvgraph_vertex_out_of_range);
+    }
+    else if (ri->offset_step <= 0) {
+        return (bvgraph_requires_offsets);
+    }
+
+    {
+        cache_entry *e = cache_find(&ri->cache, x);
+        if (e) {
+            *arc = find_successor(e->a, e->d, y) >= 0;
+            return (0);
         }
-        else
-        {          
-            // TODO clean this code up          
-            // copy the information from the masked iterator
-
-            int64_t mask_index = 0;
-            // this variable is intended to shadow the vector len
-            int64_t len = 0;
-
-            for (i=0; i < (signed)outd_ref; )
-            {
-                if (len <= 0)
-                {
-                    if (block_count == mask_index) 
-                    {
-                        if (block_count % 2 == 0) {
-                            len = ri->outd_cache[ref_index] - i;
-                        }
-                        else {
-                            break;
-                        }
-                    }
-                    else {
-                        if (mask_index % 2 == 0) { len = ri->block.a[mask_index++]; }
-                        else { i += ri->block.a[mask_index++]; continue; }
-                    }
-
-                    // in the case that length is 0, we continue.
-                    if (len == 0) { continue; }
-                }
+    }
+    if (g->shared_cache) {
+        bvgraph_shared_list *list = shared_cache_find(g->shared_cache, x);
+        if (list) {
+            *arc = find_successor(list->a, list->d, y) >= 0;
+            bvgraph_shared_list_release(list);
+            return (0);
+        }
+    }
 
-                ri->buf2.a[buf2_index++] = ref_links[i];
-                len--;
-                i++;
-            }
+    rval = position_bvgraph(ri, x, &d);
+    if (rval || d == 0) { return (rval); }
+    if (g->window_size > 0) { ref = read_reference(g, bf); }
+    pos = bitfile_tell(bf);
 
-            merge_int_arrays(ri->buf1.a, buf1_index, ri->buf2.a, buf2_index, 
-                    ri->successors.a, ri->successors.elements);
+    if (ref > 0) {
+        int64_t block_count = read_block_count(g, bf), total = 0;
+        for (i = 0; i < block_count; i++) {
+            int64_t block = read_block(g, bf) + (i == 0 ? 0 : 1);
+            total += block;
+            if (i % 2 == 0) { copied += block; }
+        }
+        if (block_count % 2 == 0) {
+            // the outdegree bitfile leaves the position of bf alone
+            uint64_t outd_ref;
+            rval = bvgraph_random_outdegree(ri, x - ref, &outd_ref);
+            if (rval) { return (rval); }
+            copied += (int64_t)outd_ref - total;
+        }
+    }
+    extra_count = (int64_t)d - copied;
 
-            buf1_index = buf1_index + buf2_index;
-            buf2_index = 0;
-            
-            // free the successors of referred node
-            free(ref_links);
+    if (extra_count > 0 && g->min_interval_length != 0 && 
+        (interval_count = bitfile_read_gamma(bf)) != 0) 
+    {
+        int64_t left, prev = 0;
+        for (i = 0; i < interval_count; i++) {
+            int64_t len;
+            if (i == 0) { left = nat2int(bitfile_read_gamma(bf)) + x; }
+            else { left = bitfile_read_gamma(bf) + prev + 1; }
+            len = bitfile_read_gamma(bf) + g->min_interval_length;
+            if (left <= y && y < left + len) {
+                *arc = 1;
+                return (0);
+            }
+            prev = left + len;
+            extra_count -= len;
         }
     }
 
+    if (extra_count > 0) {
+        // the residuals are increasing, so stop at the first one past y
+        int64_t residual = x + nat2int(read_residual(g, bf));
+        while (residual < y && --extra_count > 0) {
+            residual = read_residual(g, bf) + residual + 1;
+        }
+        if (residual == y) {
+            *arc = 1;
+            return (0);
+        }
+    }
 
-    if (start){
-        *start = ri->successors.a;
+    if (copied > 0) {
+        int64_t *links, k;
+        uint64_t outd_ref;
+        rval = bvgraph_random_successors(ri, x - ref, &links, &outd_ref);
+        if (rval) { return (rval); }
+        k = find_successor(links, (int64_t)outd_ref, y);
+        if (k >= 0) {
+            // read the blocks of x again, as the query reused the bitfile
+            rval = bitfile_position(bf, pos);
+            if (rval) { return (rval); }
+            *arc = block_copies(g, bf, k);
+        }
     }
-    
     return (0);
+}
 
+/** Set the byte budget of the successor cache of a random iterator.
+ *
+ * The cache keeps successor lists decoded by bvgraph_random_successors,
+ * for the queried nodes and for the references they copy from, so hub 
+ * nodes and common references are decoded once.  The budget counts the
+ * successors and the bookkeeping of each list.  A smaller budget evicts
+ * lists right away, and 0, the default, empties and disables the cache.
+ * The hits and misses of ri->cache count the lookups of both queries 
+ * and references.
+ *
+ * The cache belongs to the iterator, so it needs no locks.
+ *
+ * @param[in] ri the random iterator
+ * @param[in] bytes the largest number of bytes in the cache
+ * @return 0 on success
+ */
+int bvgraph_random_cache_size(bvgraph_random_iterator *ri, size_t bytes)
+{
+    ri->cache.budget = bytes;
+    cache_evict(&ri->cache, 0);
+    return (0);
 }
 
 /** Release memory associated with the random iterator.
@@ -403,11 +996,28 @@ int bvgraph_random_free(bvgraph_random_iterator* ri)
     //    ri->g->max_outd = ri->max_out;
     //}
 
+    bvgraph_random_cache_size(ri, 0);
+    bvgraph_shared_list_release(ri->shared);
+    ri->shared = NULL;
     bitfile_close(&ri->bf);
     bitfile_close(&ri->outd_bf);
     if (ri->bf.f) { fclose(ri->bf.f); }
     free(ri->outd_cache);
-    int_vector_free(&ri->successors);
+    free(ri->outd_memo);
+    for (i=0; i < ri->earlier_size; i++) {
+        free(ri->earlier_outd[i]);
+    }
+    free(ri->earlier_outd);
+    free(ri->walk_pos);
+    ri->earlier_outd = NULL;
+    ri->walk_pos = NULL;
+    ri->earlier_size = 0;
+    for (i=0; i < ri->chain_size; i++) {
+        int_vector_free(&ri->chain[i].links);
+    }
+    free(ri->chain);
+    ri->chain = NULL;
+    ri->chain_size = 0;
     for (i=0; i < ri->cyclic_buffer_size; i++) {
         int_vector_free(&ri->window[i]);
     }
@@ -416,8 +1026,6 @@ int bvgraph_random_free(bvgraph_random_iterator* ri)
     int_vector_free(&ri->block);
     int_vector_free(&ri->left);
     int_vector_free(&ri->len);
-    int_vector_free(&ri->buf1);
-    int_vector_free(&ri->buf2);
     ri->g = NULL;
     return (0);
 }
@@ -0,0 +1,384 @@
+/*
+ * David Gleich
+ * Copyright, Stanford University, 2026
+ * 17 October 2026
+ */
+
+/**
+ * @file bvgraph_shared_cache.c
+ * A cache of decoded successor lists shared by the random access
+ * iterators of a graph.
+ *
+ * The cache is split into shards by node.  Each shard is a hash table
+ * with a read-write lock, so lookups in a shard run at the same time and
+ * only an insert or an eviction takes the shard for itself.  The lists
+ * are immutable and reference counted: a lookup takes a reference under
+ * the read lock, and an evicted list is freed by the last holder, so a
+ * thread never copies a list and never sees one freed under it.
+ *
+ * The locks are pthread read-write locks, or slim reader-writer locks on
+ * Windows, and the counters use the atomics of GCC or of MSVC.  Without
+ * both, bvgraph_shared_cache_create fails.
+ *
+ * @version
+ *
+ * 2026-10-17: Initial version
+ *             Use SRWLOCK and Interlocked atomics on Windows, and fail to
+ *             create the cache without locks or atomics
+ */
+
+#include "bvgraph_internal.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define HAVE_PTHREADS
+#include <pthread.h>
+#elif defined(_WIN32)
+#define HAVE_SRWLOCK
+#include <windows.h>
+#endif /* __unix__ || __APPLE__ */
+
+// the FNV hash mixes the bytes of an int64_t key well enough
+#define HASH_FUNCTION HASH_FNV
+#include "uthash.h"
+
+#if defined(__GNUC__)
+#define HAVE_ATOMICS
+#define ATOMIC_ADD(p, v) __sync_add_and_fetch((p), (v))
+#define ATOMIC_ADD64(p, v) __sync_add_and_fetch((p), (v))
+#define ATOMIC_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+#elif defined(_MSC_VER)
+#define HAVE_ATOMICS
+#define ATOMIC_ADD(p, v) InterlockedAdd((volatile LONG*)(p), (v))
+#define ATOMIC_ADD64(p, v) ((uint64_t)InterlockedAdd64((volatile LONG64*)(p), (v)))
+#define ATOMIC_STORE(p, v) InterlockedExchange((volatile LONG*)(p), (v))
+#else
+// without atomics, bvgraph_shared_cache_create fails
+#define ATOMIC_ADD(p, v) (*(p) += (v))
+#define ATOMIC_ADD64(p, v) (*(p) += (v))
+#define ATOMIC_STORE(p, v) (*(p) = (v))
+#endif
+
+#if (defined(HAVE_PTHREADS) || defined(HAVE_SRWLOCK)) && defined(HAVE_ATOMICS)
+#define HAVE_SHARED_CACHE
+#endif
+
+/** The default number of shards */
+#define SHARED_CACHE_SHARDS 64
+
+/** A list in the shared cache.  The successors are stored in the same
+ * allocation, after the entry.
+ */
+typedef struct shared_entry {
+    bvgraph_shared_list list;   ///< the public part, first for the casts
+    int refs;                   ///< the holders, including the cache
+    int referenced;             ///< set when found, cleared by the clock hand
+    UT_hash_handle hh;
+} shared_entry;
+
+/** A shard of the shared cache */
+struct shared_shard {
+#ifdef HAVE_PTHREADS
+    pthread_rwlock_t lock;
+#elif defined(HAVE_SRWLOCK)
+    SRWLOCK lock;
+#endif
+    shared_entry *entries;
+    shared_entry *hand;     ///< the next entry for the clock
+    size_t budget;
+    size_t bytes;
+    uint64_t hits;
+    uint64_t misses;
+};
+
+struct bvgraph_shared_cache_tag {
+    int nshards;
+    struct shared_shard *shards;
+};
+
+/** The bytes of a shared entry with d successors */
+static size_t shared_entry_bytes(int64_t d)
+{
+    return sizeof(shared_entry) + sizeof(int64_t)*(size_t)d;
+}
+
+/** Allocate a list with one reference.
+ * @return the entry, or NULL if there is no memory
+ */
+static shared_entry* shared_entry_create(int64_t x, int64_t d, const int64_t *a)
+{
+    shared_entry *e = malloc(shared_entry_bytes(d));
+    if (!e) { return (NULL); }
+    if (d > 0) { memcpy(e + 1, a, sizeof(int64_t)*d); }
+    e->list.x = x;
+    e->list.d = d;
+    e->list.a = (const int64_t*)(e + 1);
+    e->refs = 1;
+    e->referenced = 0;
+    return (e);
+}
+
+/** The shard of a node */
+static struct shared_shard* node_shard(struct bvgraph_shared_cache_tag *c,
+                                       int64_t x)
+{
+    uint64_t h = ((uint64_t)x * UINT64_C(0x9E3779B97F4A7C15)) >> 32;
+    return &c->shards[h % (uint64_t)c->nshards];
+}
+
+static void shard_rdlock(struct shared_shard *s)
+{
+#ifdef HAVE_PTHREADS
+    pthread_rwlock_rdlock(&s->lock);
+#elif defined(HAVE_SRWLOCK)
+    AcquireSRWLockShared(&s->lock);
+#endif
+}
+
+static void shard_wrlock(struct shared_shard *s)
+{
+#ifdef HAVE_PTHREADS
+    pthread_rwlock_wrlock(&s->lock);
+#elif defined(HAVE_SRWLOCK)
+    AcquireSRWLockExclusive(&s->lock);
+#endif
+}
+
+static void shard_rdunlock(struct shared_shard *s)
+{
+#ifdef HAVE_PTHREADS
+    pthread_rwlock_unlock(&s->lock);
+#elif defined(HAVE_SRWLOCK)
+    ReleaseSRWLockShared(&s->lock);
+#endif
+}
+
+static void shard_wrunlock(struct shared_shard *s)
+{
+#ifdef HAVE_PTHREADS
+    pthread_rwlock_unlock(&s->lock);
+#elif defined(HAVE_SRWLOCK)
+    ReleaseSRWLockExclusive(&s->lock);
+#endif
+}
+
+/** Evict entries of a shard with the CLOCK algorithm until bytes more
+ * fit in its budget.  The caller holds the write lock.
+ */
+static void shard_evict(struct shared_shard *s, size_t bytes)
+{
+    while (s->entries && s->bytes + bytes > s->budget) {
+        shared_entry *e = s->hand ? s->hand : s->entries;
+        s->hand = (shared_entry*)e->hh.next;
+        if (e->referenced) {
+            e->referenced = 0;
+        } else {
+            HASH_DELETE(hh, s->entries, e);
+            s->bytes -= shared_entry_bytes(e->list.d);
+            bvgraph_shared_list_release(&e->list);
+        }
+    }
+    if (!s->entries) { s->hand = NULL; }
+}
+
+/** Create a successor cache shared by the random access iterators of a
+ * graph.
+ *
+ * After this call, bvgraph_random_successors looks up each query in the
+ * shared cache and adds the lists it decodes, so a list that many
+ * threads query is decoded once.  The query still returns a pointer
+ * valid until the next call on the same iterator: the iterator holds a
+ * reference to the list.  bvgraph_random_shared_successors returns the
+ * reference itself.
+ *
+ * Each shard gets bytes/nshards bytes and evicts with the CLOCK
+ * algorithm.  More shards mean fewer threads on each lock.  Call this
+ * before creating the iterators that share the cache; bvgraph_close
+ * releases it.
+ *
+ * @param[in] g the graph
+ * @param[in] bytes the largest number of bytes in the cache
+ * @param[in] nshards the number of shards, or 0 for the default of 64
+ * @return 0 on success, bvgraph_call_unsupported if the graph already
+ *         has a shared cache or the platform has no locks or atomics
+ */
+int bvgraph_shared_cache_create(bvgraph *g, size_t bytes, int nshards)
+{
+    struct bvgraph_shared_cache_tag *c;
+    int k;
+#ifndef HAVE_SHARED_CACHE
+    return (bvgraph_call_unsupported);
+#endif
+    if (g->shared_cache) { return (bvgraph_call_unsupported); }
+    if (nshards <= 0) { nshards = SHARED_CACHE_SHARDS; }
+    c = malloc(sizeof(struct bvgraph_shared_cache_tag));
+    if (!c) { return (bvgraph_call_out_of_memory); }
+    c->nshards = nshards;
+    c->shards = calloc((size_t)nshards, sizeof(struct shared_shard));
+    if (!c->shards) { free(c); return (bvgraph_call_out_of_memory); }
+    for (k = 0; k < nshards; k++) {
+        c->shards[k].budget = bytes / (size_t)nshards;
+#ifdef HAVE_PTHREADS
+        pthread_rwlock_init(&c->shards[k].lock, NULL);
+#elif defined(HAVE_SRWLOCK)
+        InitializeSRWLock(&c->shards[k].lock);
+#endif
+    }
+    g->shared_cache = c;
+    return (0);
+}
+
+/** Report the lookups and the size of the shared cache of a graph.
+ *
+ * @param[in] g the graph
+ * @param[out] hits the lookups found in the cache, or NULL
+ * @param[out] misses the lookups decoded from the graph, or NULL
+ * @param[out] bytes the bytes in the cache, or NULL
+ * @return 0 on success, bvgraph_call_unsupported without a shared cache
+ */
+int bvgraph_shared_cache_stats(bvgraph *g, uint64_t *hits, uint64_t *misses,
+                               size_t *bytes)
+{
+    struct bvgraph_shared_cache_tag *c = g->shared_cache;
+    uint64_t h = 0, m = 0;
+    size_t b = 0;
+    int k;
+    if (!c) { return (bvgraph_call_unsupported); }
+    for (k = 0; k < c->nshards; k++) {
+        struct shared_shard *s = &c->shards[k];
+        shard_rdlock(s);
+        // lookups under other read locks still count
+        h += ATOMIC_ADD64(&s->hits, 0);
+        m += ATOMIC_ADD64(&s->misses, 0);
+        b += s->bytes;
+        shard_rdunlock(s);
+    }
+    if (hits) { *hits = h; }
+    if (misses) { *misses = m; }
+    if (bytes) { *bytes = b; }
+    return (0);
+}
+
+/** Release a reference to a shared list.  The last reference frees it.
+ *
+ * @param[in] list the list, or NULL
+ * @return 0 on success
+ */
+int bvgraph_shared_list_release(bvgraph_shared_list *list)
+{
+    shared_entry *e = (shared_entry*)list;
+    if (e && ATOMIC_ADD(&e->refs, -1) == 0) { free(e); }
+    return (0);
+}
+
+/** Get the successors of a node as a reference counted list.
+ *
+ * The list comes from the shared cache of the graph, or is decoded with
+ * the iterator and added to the cache.  It stays valid until the caller
+ * releases it with bvgraph_shared_list_release, after later queries on
+ * the iterator and after evictions.  Without a shared cache, or for a
+ * list that does not fit in a shard, the list is a copy that only the
+ * caller holds.
+ *
+ * @param[in] ri a random access iterator for the graph
+ * @param[in] x the node
+ * @param[out] list the list
+ * @return 0 on success
+ */
+int bvgraph_random_shared_successors(bvgraph_random_iterator *ri,
+                                     int64_t x, bvgraph_shared_list **list)
+{
+    int64_t *links;
+    uint64_t d;
+    int rval = bvgraph_random_successors(ri, x, &links, &d);
+    if (rval) { return (rval); }
+    if (ri->shared) {
+        ATOMIC_ADD(&((shared_entry*)ri->shared)->refs, 1);
+        *list = ri->shared;
+    } else {
+        shared_entry *e = shared_entry_create(x, (int64_t)d, links);
+        if (!e) { return (bvgraph_call_out_of_memory); }
+        *list = &e->list;
+    }
+    return (0);
+}
+
+/** Look up a node in a shared cache.
+ *
+ * @param c the cache
+ * @param x the node
+ * @return the list with a reference for the caller, or NULL
+ */
+bvgraph_shared_list* shared_cache_find(struct bvgraph_shared_cache_tag *c,
+                                       int64_t x)
+{
+    struct shared_shard *s = node_shard(c, x);
+    shared_entry *e = NULL;
+    shard_rdlock(s);
+    HASH_FIND(hh, s->entries, &x, sizeof(int64_t), e);
+    if (e) {
+        ATOMIC_ADD(&e->refs, 1);
+        ATOMIC_STORE(&e->referenced, 1);
+        ATOMIC_ADD64(&s->hits, 1);
+    } else {
+        ATOMIC_ADD64(&s->misses, 1);
+    }
+    shard_rdunlock(s);
+    return (e ? &e->list : NULL);
+}
+
+/** Add the successors of a node to a shared cache, unless they are
+ * larger than a shard.  If another thread added the node first, its
+ * list is used.
+ *
+ * @param c the cache
+ * @param x the node
+ * @param d its outdegree
+ * @param a its successors
+ * @return the list with a reference for the caller, or NULL
+ */
+bvgraph_shared_list* shared_cache_insert(struct bvgraph_shared_cache_tag *c,
+                                         int64_t x, int64_t d, const int64_t *a)
+{
+    struct shared_shard *s = node_shard(c, x);
+    size_t bytes = shared_entry_bytes(d);
+    shared_entry *e = NULL;
+    if (bytes > s->budget) { return (NULL); }
+    shard_wrlock(s);
+    HASH_FIND(hh, s->entries, &x, sizeof(int64_t), e);
+    if (!e) {
+        shard_evict(s, bytes);
+        e = shared_entry_create(x, d, a);
+        if (e) {
+            HASH_ADD(hh, s->entries, list.x, sizeof(int64_t), e);
+            s->bytes += bytes;
+        }
+    }
+    // one reference for the cache and one for the caller
+    if (e) { ATOMIC_ADD(&e->refs, 1); }
+    shard_wrunlock(s);
+    return (e ? &e->list : NULL);
+}
+
+/** Release a shared cache.  Lists still held by iterators are freed
+ * when they are released.
+ *
+ * @param c the cache, or NULL
+ */
+void shared_cache_free(struct bvgraph_shared_cache_tag *c)
+{
+    int k;
+    if (!c) { return; }
+    for (k = 0; k < c->nshards; k++) {
+        struct shared_shard *s = &c->shards[k];
+        shared_entry *e, *tmp;
+        HASH_ITER(hh, s->entries, e, tmp) {
+            HASH_DELETE(hh, s->entries, e);
+            bvgraph_shared_list_release(&e->list);
+        }
+#ifdef HAVE_PTHREADS
+        pthread_rwlock_destroy(&s->lock);
+#endif
+    }
+    free(c->shards);
+    free(c);
+}
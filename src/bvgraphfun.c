@@ -24,6 +24,10 @@
  * 
  * 4 March 2008
  * Added compensated summation
+ *
+ *  2026-10-17: Use bvgraph_iterator32 in bvgraph_mult and bvgraph_transmult
+ *              when the node ids fit in 32 bits
+ *              Compute the row sums from an outdegree scan
  */
 
 #include "bvgraph.h"
@@ -44,6 +48,51 @@
 
 #include <string.h>
 
+/**
+ * Computes a matrix vector product y = A*x with the 32-bit iterator.
+ */
+static int mult32(bvgraph *g, double *x, double *y)
+{
+    bvgraph_iterator32 iter;
+    uint32_t *links; uint64_t i, d;
+    int rval = bvgraph_nonzero_iterator32(g, &iter);
+    if (rval != 0) { return rval; } 
+    for (; bvgraph_iterator32_valid(&iter); 
+         bvgraph_iterator32_next(&iter))
+    {
+        double v = 0;
+        bvgraph_iterator32_outedges(&iter, &links, &d);
+        for (i = 0; i < d; i++) {
+            v += x[links[i]];
+        }
+        *(y++) = v;
+    }
+    bvgraph_iterator32_free(&iter);
+    return (0);
+}
+
+/**
+ * Computes a matrix vector product y = A'*x with the 32-bit iterator.
+ */
+static int transmult32(bvgraph *g, double *x, double *y)
+{
+    bvgraph_iterator32 iter;
+    uint32_t *links; uint64_t i, d;
+    int rval = bvgraph_nonzero_iterator32(g, &iter);
+    if (rval != 0) { return rval; }
+    memset(y, 0, sizeof(double)*g->n); 
+    for (; bvgraph_iterator32_valid(&iter); 
+         bvgraph_iterator32_next(&iter))
+    {
+        bvgraph_iterator32_outedges(&iter, &links, &d);
+        for (i = 0; i < d; i++) {
+            y[links[i]] += x[iter.curr];
+        }
+    }
+    bvgraph_iterator32_free(&iter);
+    return (0);
+}
+
 /**
  * Computes a matrix vector product y = A*x 
  *
@@ -56,7 +105,11 @@ int bvgraph_mult(bvgraph *g, double *x, double *y)
 {
     bvgraph_iterator iter;
     int64_t *links; uint64_t i, d;
-    int rval = bvgraph_nonzero_iterator(g, &iter);
+    int rval;
+    if ((uint64_t)g->n <= BVGRAPH_ITERATOR32_MAX_NODES) { 
+        return mult32(g, x, y); 
+    }
+    rval = bvgraph_nonzero_iterator(g, &iter);
     if (rval != 0) { return rval; } 
     for (; bvgraph_iterator_valid(&iter); 
          bvgraph_iterator_next(&iter))
@@ -84,7 +137,11 @@ int bvgraph_transmult(bvgraph *g, double *x, double *y)
 {
     bvgraph_iterator iter;
     int64_t *links; uint64_t i, d;
-    int rval = bvgraph_nonzero_iterator(g, &iter);
+    int rval;
+    if ((uint64_t)g->n <= BVGRAPH_ITERATOR32_MAX_NODES) { 
+        return transmult32(g, x, y); 
+    }
+    rval = bvgraph_nonzero_iterator(g, &iter);
     if (rval != 0) { return rval; }
     memset(y, 0, sizeof(double)*g->n); 
     for (; bvgraph_iterator_valid(&iter); 
@@ -143,18 +200,16 @@ int bvgraph_relax_sor(bvgraph *g, double *x, double w)
  */
 int bvgraph_sum_row(bvgraph *g, double *x)
 {
-    bvgraph_iterator iter;
-    uint64_t d;
-    int rval = bvgraph_nonzero_iterator(g, &iter);
+    bvgraph_outdegree_iterator iter;
+    int rval = bvgraph_outdegree_range_iterator(g, 0, g->n, &iter);
     if (rval != 0) { return rval; } 
-    for (; bvgraph_iterator_valid(&iter); 
-         bvgraph_iterator_next(&iter))
+    for (; bvgraph_outdegree_iterator_valid(&iter) && rval == 0; 
+         rval = bvgraph_outdegree_iterator_next(&iter))
     {
-        bvgraph_iterator_outedges(&iter, NULL, &d);
-        *(x++) = (double)d;
+        *(x++) = (double)iter.curr_outd;
     }
-    bvgraph_iterator_free(&iter);
-    return (0);
+    bvgraph_outdegree_iterator_free(&iter);
+    return (rval);
 }
 
 /**
@@ -314,22 +369,22 @@ int bvgraph_substochastic_transmult(bvgraph *g, double *x, double *y)
  */
 int bvgraph_substochastic_sum_row(bvgraph *g, double *x)
 {
-    bvgraph_iterator iter; register double y1,y2,t,z,id;
-    uint64_t d;
-    int rval = bvgraph_nonzero_iterator(g, &iter);
+    bvgraph_outdegree_iterator iter; register double y1,y2,t,z,id;
+    int64_t d;
+    int rval = bvgraph_outdegree_range_iterator(g, 0, g->n, &iter);
     if (rval != 0) { return rval; } 
     y1 = 0.0;
     y2 = 0.0;
-    for (; bvgraph_iterator_valid(&iter); 
-         bvgraph_iterator_next(&iter))
+    for (; bvgraph_outdegree_iterator_valid(&iter) && rval == 0; 
+         rval = bvgraph_outdegree_iterator_next(&iter))
     {
-        bvgraph_iterator_outedges(&iter, NULL, &d);
+        d = iter.curr_outd;
         id=1.0/(double)d;
         while (d-->0) { CSUM2(id,y1,y2,t,z); } // implement compensated sum
         *(x++) = FCSUM2(y1,y2);
     }
-    bvgraph_iterator_free(&iter);
-    return (0);
+    bvgraph_outdegree_iterator_free(&iter);
+    return (rval);
 }
 
 /**
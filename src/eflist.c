@@ -24,6 +24,8 @@
 const int eflist_out_of_bound = -1; ///< ef-list out of bound
 const int eflist_batch_nondecreasing = -2; ///< the array is not nondecreaing in batch mode
 const int eflist_external_memory_too_small = -3; ///< the exteranl memory is too small for the eflist
+const int eflist_out_of_memory = -4; ///< the spill could not grow
+const int eflist_io_error = -5; ///< the list could not be saved or loaded
  
 /**
  * Define constants for bit operations.
@@ -46,6 +48,9 @@ const unsigned int MAX_SPAN = (1 << 16);
  * @return the number of 1's in the word
  */
 static int bit_count(int64_t x) {
+#if defined(__GNUC__)
+    return __builtin_popcountll((uint64_t)x);
+#endif
     x = (x & m1 ) + ((x >>  1) & m1 ); //put count of each  2 bits into those  2 bits 
     x = (x & m2 ) + ((x >>  2) & m2 ); //put count of each  4 bits into those  4 bits 
     x = (x & m4 ) + ((x >>  4) & m4 ); //put count of each  8 bits into those  8 bits 
@@ -55,6 +60,28 @@ static int bit_count(int64_t x) {
     return (int)x;
 }
 
+/**
+ * Return the position, counting from the most significant bit, of
+ * the r-th 1 in a word.
+ *
+ * @param[in] x the 64-bit word, with at least r 1's
+ * @param[in] r the rank of the 1, r >= 1
+ * @return the position of the r-th 1
+ */
+static int select_in_word(uint64_t x, int r) {
+    const uint64_t left1 = 0x8000000000000000;
+    int i = 0;
+    for (;;) {
+#if defined(__GNUC__)
+        i = __builtin_clzll(x);
+#else
+        while ((x & (left1 >> i)) == 0) { i ++; }
+#endif
+        if (--r == 0) { return i; }
+        x &= ~(left1 >> i);
+    }
+}
+
 /**
  * Return the floor of logarithmic value of base 2.
  *
@@ -126,25 +153,31 @@ static int simple_select_build(elias_fano_list *ef)
                 // need to spill
                 if (ef->spill_size - ef->spill_curr < (unsigned int)ef->ones_per_inventory) {
                     int64_t *tmp = ef->exact_spill;
+                    uint64_t new_size = ef->spill_size * 2;
                     if (ef->memory_external) {
                         return eflist_external_memory_too_small;
                     }
-                    // double the size of current spill size
-                    ef->exact_spill = (int64_t*)malloc(sizeof(int64_t) * ef->spill_size * 2);
-                    memset(ef->exact_spill, 0, sizeof(int64_t) * ef->spill_size * 2);
-                    memcpy(ef->exact_spill, tmp, ef->spill_size);
+                    // at least double the size of current spill size
+                    if (new_size < ef->spill_curr + ef->ones_per_inventory) {
+                        new_size = ef->spill_curr + ef->ones_per_inventory;
+                    }
+                    ef->exact_spill = (int64_t*)malloc(sizeof(int64_t) * new_size);
+                    if (!ef->exact_spill) {
+                        ef->exact_spill = tmp;
+                        return eflist_out_of_memory;
+                    }
+                    memset(ef->exact_spill, 0, sizeof(int64_t) * new_size);
+                    memcpy(ef->exact_spill, tmp, sizeof(int64_t) * ef->spill_curr);
                     free(tmp);
-                    ef->spill_size *= 2;
+                    ef->spill_size = new_size;
                 }
-                start = ef->inventory[inventory_index - 1];                
-                for (i = 0; i < ef->ones_per_inventory; i ++) {
-                    if ((i & ef->ones_per_inventory_mask) == 0) {
-                        // TODO fix the warning on this one
-                        ef->inventory[inventory_index - 1] = -ef->spill_curr;
-                    }                    
+                start = ef->inventory[inventory_index - 1];
+                // a spilled inventory entry holds -(its index in the spill) - 1
+                ef->inventory[inventory_index - 1] = -(int64_t)ef->spill_curr - 1;
+                ef->exact_spill[ef->spill_curr ++] = start;
+                for (i = 1; i < ef->ones_per_inventory; i ++) {
                     ef->exact_spill[ef->spill_curr ++] = bit_search((void *)(ef->upper).A, start + 1, i);
                 }
-                
             }
         }
     }
@@ -171,48 +204,26 @@ static int64_t select_rank(uint64_t rank, elias_fano_list *ef)
         // compute the offset in the inventory
         int subrank = (int)(rank & ef->ones_per_inventory_mask); 
 
-        if (subrank == 0) {
-            return inventory_rank & ~((int64_t)1 << 63);
-        } else if (inventory_rank < 0) {
-            return ef->exact_spill[(int)(-inventory_rank + subrank)];
+        if (inventory_rank < 0) {
+            return ef->exact_spill[-inventory_rank - 1 + subrank];
+        } else if (subrank == 0) {
+            return inventory_rank;
         } else {
-            int64_t j, k;
-            
             int64_t upper_index = inventory_rank >> 6;
-            int64_t offset = inventory_rank & ((1L << 6) - 1);
-            int ones; 
+            int offset = (int)(inventory_rank & 63);
+            // the bits strictly after the inventory position
+            uint64_t word = offset == 63 ? 0 : 
+                (ef->upper).A[upper_index] & (~(uint64_t)0 >> (offset + 1));
+            int ones = bit_count(word);
 
             // sequential search for 1's, long word by long word
-            // 
-            uint64_t left1 = 0x8000000000000000;
-            for (k = offset+1; k < 64; k ++) {
-                if ((((ef->upper).A[upper_index] & (left1 >> k)) != 0) && (subrank != 0)) {
-                    subrank --;
-                }
-                if (subrank==0) {
-                    return (upper_index << 6) + k;
-                }
-            }
-            upper_index ++;
-            ones = bit_count((ef->upper).A[upper_index]);
-
             while (ones < subrank) {
                 subrank -= ones;
                 upper_index ++;
-                ones = bit_count((ef->upper).A[upper_index]);
-            }
-    
-            // need to refactor this function
-            for (j = 0; j < 64; j ++) {
-                if ((((ef->upper).A[upper_index] & (left1 >> j)) != 0) && (subrank != 0)) {
-                    subrank --;
-                }
-                if (subrank == 0) {
-                    return (upper_index << 6) + j;
-                }
+                word = (ef->upper).A[upper_index];
+                ones = bit_count(word);
             }
-            // TODO is this the correct final return?
-            return 0;
+            return (upper_index << 6) + select_in_word(word, subrank);
         }
     }
 }
@@ -430,7 +441,7 @@ int eflist_create_external(elias_fano_list *ef, uint64_t num_elements, uint64_t
             array_len = (upper_length + 63) / 64;
             ef->inventory = (int64_t *)(ef->upper).A + array_len;
             array_len = ef->inventory_size + 1;
-            ef->exact_spill = ef->inventory + array_len * 8;
+            ef->exact_spill = ef->inventory + array_len;
         }
     }
     return 0;
@@ -534,6 +545,84 @@ int eflist_free(elias_fano_list *ef)
     return (0);
 }
 
+/** The first word of a saved eflist, "BVGEF" and a format version */
+static const uint64_t EFLIST_MAGIC = 0x4256474546000001ULL;
+
+/**
+ * Save a complete eflist, including its select index, to a file.  
+ * The file is a header of 64-bit words (a magic number, the number of
+ * elements, the largest element and the spill length) followed by the
+ * lower bits, the upper bits, the inventory and the spill, all in the 
+ * byte order of this machine.
+ *
+ * @param[in] ef the Elias-Fano list with all of its elements added
+ * @param[in] f a file open for binary writing
+ * @return 0 on success; eflist_io_error if the file could not be written
+ */
+int eflist_save(elias_fano_list *ef, FILE *f)
+{
+    uint64_t header[4];
+    size_t lower_len = ((ef->lower).s * ef->size + 63) / 64;
+    size_t upper_len = ((ef->upper).size + 63) / 64;
+    size_t inventory_len = ef->inventory_size + 1;
+    header[0] = EFLIST_MAGIC;
+    header[1] = ef->size;
+    header[2] = ef->largest;
+    header[3] = ef->spill_curr;
+    if (ef->curr != ef->size ||
+        fwrite(header, sizeof(uint64_t), 4, f) != 4 ||
+        fwrite((ef->lower).A, sizeof(uint64_t), lower_len, f) != lower_len ||
+        fwrite((ef->upper).A, sizeof(uint64_t), upper_len, f) != upper_len ||
+        fwrite(ef->inventory, sizeof(int64_t), inventory_len, f) != inventory_len ||
+        fwrite(ef->exact_spill, sizeof(int64_t), ef->spill_curr, f) != ef->spill_curr) {
+        return eflist_io_error;
+    }
+    return 0;
+}
+
+/**
+ * Load an eflist saved with eflist_save.  This only reads the arrays, 
+ * without adding the elements again.  The list is internal memory and 
+ * must be released with eflist_free.
+ *
+ * @param[in] ef the Elias-Fano list
+ * @param[in] f a file open for binary reading
+ * @return 0 on success; eflist_io_error if the file is not a saved eflist; 
+ * eflist_out_of_memory if the list could not be allocated
+ */
+int eflist_load(elias_fano_list *ef, FILE *f)
+{
+    uint64_t header[4];
+    size_t lower_len, upper_len, inventory_len;
+    if (fread(header, sizeof(uint64_t), 4, f) != 4 || header[0] != EFLIST_MAGIC) {
+        return eflist_io_error;
+    }
+    eflist_create(ef, header[1], header[2]);
+    if (ef->spill_size < header[3]) {
+        free(ef->exact_spill);
+        ef->spill_size = header[3];
+        ef->exact_spill = malloc(sizeof(int64_t) * ef->spill_size);
+    }
+    lower_len = ((ef->lower).s * ef->size + 63) / 64;
+    upper_len = ((ef->upper).size + 63) / 64;
+    inventory_len = ef->inventory_size + 1;
+    if (!ef->inventory || (ef->spill_size > 0 && !ef->exact_spill) || 
+        (lower_len > 0 && !(ef->lower).A) || (upper_len > 0 && !(ef->upper).A)) {
+        eflist_free(ef);
+        return eflist_out_of_memory;
+    }
+    ef->spill_curr = header[3];
+    if (fread((ef->lower).A, sizeof(uint64_t), lower_len, f) != lower_len ||
+        fread((ef->upper).A, sizeof(uint64_t), upper_len, f) != upper_len ||
+        fread(ef->inventory, sizeof(int64_t), inventory_len, f) != inventory_len ||
+        fread(ef->exact_spill, sizeof(int64_t), ef->spill_curr, f) != ef->spill_curr) {
+        eflist_free(ef);
+        return eflist_io_error;
+    }
+    ef->curr = ef->size;
+    return 0;
+}
+
 /** 
  * This function computes how much memory is required for an eflist.
  * 
@@ -32,6 +32,10 @@
  *
  * 2008-01-15
  * Added strnlen for APPLE_CC 
+ *
+ * 2026-10-17
+ * Added GOLOMB and SKEWED_GOLOMB compression flags and the golombb
+ *   properties for their moduli
  */
  
 #ifdef __GNUC__
@@ -365,6 +369,30 @@ int parse_compression_flags(bvgraph* g, const char* flagstr, uint len)
                 g->offset_coding = BVGRAPH_FLAG_GAMMA;
             } else if (strncmp(prev_bar_pos+1, " OFFSETS_DELTA",    minf(substrlen, 14)) == 0) {
                 g->offset_coding = BVGRAPH_FLAG_DELTA;
+            } else if (strncmp(prev_bar_pos+1, " OUTDEGREES_GOLOMB", minf(substrlen, 18)) == 0) {
+                g->outdegree_coding = BVGRAPH_FLAG_GOLOMB;
+            } else if (strncmp(prev_bar_pos+1, " OUTDEGREES_SKEWED_GOLOMB", minf(substrlen, 25)) == 0) {
+                g->outdegree_coding = BVGRAPH_FLAG_SKEWED_GOLOMB;
+            } else if (strncmp(prev_bar_pos+1, " BLOCKS_GOLOMB",   minf(substrlen, 14)) == 0) {
+                g->block_coding = BVGRAPH_FLAG_GOLOMB;
+            } else if (strncmp(prev_bar_pos+1, " BLOCKS_SKEWED_GOLOMB", minf(substrlen, 21)) == 0) {
+                g->block_coding = BVGRAPH_FLAG_SKEWED_GOLOMB;
+            } else if (strncmp(prev_bar_pos+1, " RESIDUALS_GOLOMB", minf(substrlen, 17)) == 0) {
+                g->residual_coding = BVGRAPH_FLAG_GOLOMB;
+            } else if (strncmp(prev_bar_pos+1, " RESIDUALS_SKEWED_GOLOMB", minf(substrlen, 24)) == 0) {
+                g->residual_coding = BVGRAPH_FLAG_SKEWED_GOLOMB;
+            } else if (strncmp(prev_bar_pos+1, " REFERENCES_GOLOMB", minf(substrlen, 18)) == 0) {
+                g->reference_coding = BVGRAPH_FLAG_GOLOMB;
+            } else if (strncmp(prev_bar_pos+1, " REFERENCES_SKEWED_GOLOMB", minf(substrlen, 25)) == 0) {
+                g->reference_coding = BVGRAPH_FLAG_SKEWED_GOLOMB;
+            } else if (strncmp(prev_bar_pos+1, " BLOCK_COUNT_GOLOMB", minf(substrlen, 19)) == 0) {
+                g->block_count_coding = BVGRAPH_FLAG_GOLOMB;
+            } else if (strncmp(prev_bar_pos+1, " BLOCK_COUNT_SKEWED_GOLOMB", minf(substrlen, 26)) == 0) {
+                g->block_count_coding = BVGRAPH_FLAG_SKEWED_GOLOMB;
+            } else if (strncmp(prev_bar_pos+1, " OFFSETS_GOLOMB",  minf(substrlen, 15)) == 0) {
+                g->offset_coding = BVGRAPH_FLAG_GOLOMB;
+            } else if (strncmp(prev_bar_pos+1, " OFFSETS_SKEWED_GOLOMB", minf(substrlen, 22)) == 0) {
+                g->offset_coding = BVGRAPH_FLAG_SKEWED_GOLOMB;
             } else {
                 return bvgraph_property_file_compression_flag_error;
             }
@@ -378,6 +406,25 @@ int parse_compression_flags(bvgraph* g, const char* flagstr, uint len)
     return 0;
 }
 
+/**
+ * Fill in the Golomb modulus for one component of the graph.
+ *
+ * @param[in] coding the coding of the component
+ * @param[in,out] b the modulus from the properties file, or 0
+ * @param[in] golomb_b the modulus for all components, or 0
+ * @return 0 on success, nonzero if a Golomb coded component 
+ * has no modulus
+ */
+static int check_golomb_b(enum bvgraph_compression_flag_tag coding, 
+                          int *b, int golomb_b)
+{
+    if (*b == 0) { *b = golomb_b; }
+    if (coding == BVGRAPH_FLAG_GOLOMB || coding == BVGRAPH_FLAG_SKEWED_GOLOMB) {
+        return (*b < 1);
+    }
+    return (0);
+}
+
 /**
  * Parse the properties file for the bvgraph with a given filename.  This 
  * operation will fill in the various fields of the bvgraph structure.
@@ -392,6 +439,7 @@ int parse_properties(bvgraph* g)
     const int max_value_len = 1024;
 
     int rval = 0;
+    int golomb_b = 0; // the modulus for components without their own
 
     char *propfilename;
     FILE *propfile;
@@ -473,6 +521,20 @@ int parse_properties(bvgraph* g)
                 g->min_interval_length = atoin(value, value_len);
             } else if (strncmp(key,"zetak",key_len) == 0) {
                 g->zeta_k = atoin(value, value_len);
+            } else if (strncmp(key,"golombb",key_len) == 0) {
+                golomb_b = atoin(value, value_len);
+            } else if (strncmp(key,"outdegreesgolombb",key_len) == 0) {
+                g->outdegree_golomb_b = atoin(value, value_len);
+            } else if (strncmp(key,"blocksgolombb",key_len) == 0) {
+                g->block_golomb_b = atoin(value, value_len);
+            } else if (strncmp(key,"residualsgolombb",key_len) == 0) {
+                g->residual_golomb_b = atoin(value, value_len);
+            } else if (strncmp(key,"referencesgolombb",key_len) == 0) {
+                g->reference_golomb_b = atoin(value, value_len);
+            } else if (strncmp(key,"blockcountgolombb",key_len) == 0) {
+                g->block_count_golomb_b = atoin(value, value_len);
+            } else if (strncmp(key,"offsetsgolombb",key_len) == 0) {
+                g->offset_golomb_b = atoin(value, value_len);
             } else if (strncmp(key,"compressionflags",key_len) == 0) {
                 // this function will update the graph structure directly
                 rval = parse_compression_flags(g,value,value_len);
@@ -507,6 +569,15 @@ int parse_properties(bvgraph* g)
 
     }
 
+    // every Golomb coded component needs a modulus
+    if (check_golomb_b(g->outdegree_coding, &g->outdegree_golomb_b, golomb_b) ||
+        check_golomb_b(g->block_coding, &g->block_golomb_b, golomb_b) ||
+        check_golomb_b(g->residual_coding, &g->residual_golomb_b, golomb_b) ||
+        check_golomb_b(g->reference_coding, &g->reference_golomb_b, golomb_b) ||
+        check_golomb_b(g->block_count_coding, &g->block_count_golomb_b, golomb_b) ||
+        check_golomb_b(g->offset_coding, &g->offset_golomb_b, golomb_b)) {
+        return bvgraph_property_file_error;
+    }
 
     return 0;
 }
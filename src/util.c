@@ -18,6 +18,11 @@
  *  2008-05-09: Added int_vector_create_copy
  *			  Fixed int_vector_ensure_size to remove spurious alloc on
  *			  >= n instead of > n
+ *  2026-10-17: Added fmap, funmap and fmapadvise for memory mapped
+ *			  graphs
+ *			  Added hugepage_alloc and hugepage_bytes
+ *			  Added ftemp, fcommit and fdiscard to write files atomically
+ *			  Added int32_vector routines for bvgraph_iterator32
  */
 
 #ifdef __GNUC__
@@ -35,6 +40,12 @@
 #include <sys/types.h> 
 #include <sys/stat.h> 
 
+#if defined(__unix__) || defined(__APPLE__)
+#define HAVE_MMAP
+#include <sys/mman.h>
+#include <fcntl.h>
+#endif /* __unix__ || __APPLE__ */
+
 
 /**
  * Convert a specified number of characters into a number.  This
@@ -200,6 +211,225 @@ int fsize(const char *filename, unsigned long long *s)
 	return 0;
 }
 
+/**
+ * Map an entire file read-only into memory.
+ *
+ * @param[in] filename the name of the file
+ * @param[out] mem the start of the mapping
+ * @param[out] len the length of the mapping, the size of the file
+ * @param[in] populate if nonzero, fault in the whole file now
+ * @return 0 on success, bvgraph_call_unsupported if there is no mmap
+ * on this platform, bvgraph_call_io_error on any other failure
+ * (including an empty file, which cannot be mapped)
+ */
+int fmap(const char *filename, unsigned char **mem, size_t *len, int populate)
+{
+#ifdef HAVE_MMAP
+	unsigned long long filesize;
+	void *addr;
+	int fd;
+	int mflags = MAP_SHARED;
+
+	if (fsize(filename, &filesize) || filesize == 0 
+		|| filesize != (size_t)filesize) { 
+		return bvgraph_call_io_error; 
+	}
+	fd = open(filename, O_RDONLY);
+	if (fd < 0) { return bvgraph_call_io_error; }
+#ifdef MAP_POPULATE
+	if (populate) { mflags |= MAP_POPULATE; }
+#endif /* MAP_POPULATE */
+	addr = mmap(NULL, (size_t)filesize, PROT_READ, mflags, fd, 0);
+	// the mapping holds its own reference to the file
+	close(fd);
+	if (addr == MAP_FAILED) { return bvgraph_call_io_error; }
+#ifndef MAP_POPULATE
+	if (populate) {
+		// touch every page instead
+		volatile unsigned char sum = 0;
+		size_t i;
+		for (i = 0; i < (size_t)filesize; i += 4096) { sum ^= ((unsigned char*)addr)[i]; }
+	}
+#endif /* MAP_POPULATE */
+
+	*mem = addr;
+	*len = (size_t)filesize;
+	return (0);
+#else
+	return bvgraph_call_unsupported;
+#endif /* HAVE_MMAP */
+}
+
+/**
+ * Release a mapping from fmap.
+ * @param[in] mem the start of the mapping
+ * @param[in] len the length of the mapping
+ * @return 0 on success
+ */
+int funmap(unsigned char *mem, size_t len)
+{
+#ifdef HAVE_MMAP
+	if (munmap(mem, len)) { return bvgraph_call_io_error; }
+	return (0);
+#else
+	return bvgraph_call_unsupported;
+#endif /* HAVE_MMAP */
+}
+
+/**
+ * Tell the operating system how a mapping from fmap will be read, so
+ * it can read ahead for sequential scans and avoid it for random 
+ * access.  This is only a hint; failures are ignored.
+ *
+ * @param[in] mem the start of the mapping
+ * @param[in] len the length of the mapping
+ * @param[in] random nonzero for random access, zero for a sequential scan
+ */
+void fmapadvise(unsigned char *mem, size_t len, int random)
+{
+#ifdef HAVE_MMAP
+	if (mem && len) {
+		madvise(mem, len, random ? MADV_RANDOM : MADV_SEQUENTIAL);
+	}
+#endif /* HAVE_MMAP */
+}
+
+/** The size of a transparent huge page */
+#define HUGEPAGE_SIZE ((size_t)2 << 20)
+
+/**
+ * Allocate memory that the operating system should back with 2MB
+ * transparent huge pages.  The memory is released with free.
+ *
+ * This only requests huge pages (MADV_HUGEPAGE) and they must be 
+ * faulted in afterwards; use hugepage_bytes to see how many were
+ * granted.  Without transparent huge pages this is malloc.
+ *
+ * @param[in] size the number of bytes
+ * @return the memory or NULL
+ */
+void* hugepage_alloc(size_t size)
+{
+#if defined(HAVE_MMAP) && defined(MADV_HUGEPAGE)
+	void *mem;
+	size_t len = (size + HUGEPAGE_SIZE - 1) & ~(HUGEPAGE_SIZE - 1);
+	if (posix_memalign(&mem, HUGEPAGE_SIZE, len)) { return NULL; }
+	madvise(mem, len, MADV_HUGEPAGE);
+	return mem;
+#else
+	return malloc(size);
+#endif /* MADV_HUGEPAGE */
+}
+
+/**
+ * Count how many bytes of a block of memory are on huge pages,
+ * according to /proc/self/smaps.  
+ *
+ * The count is approximate: the kernel reports huge pages per mapping
+ * and a mapping may be larger than the block.
+ *
+ * @param[in] mem the start of the memory
+ * @param[in] len the length of the memory
+ * @param[out] bytes the number of bytes on huge pages
+ * @return 0 on success, bvgraph_call_unsupported if the operating
+ * system does not report huge pages
+ */
+int hugepage_bytes(const void *mem, size_t len, size_t *bytes)
+{
+#ifdef __linux__
+	char line[1024];
+	unsigned long long start = 0, end = 0, kb;
+	unsigned long long lo = (unsigned long long)(size_t)mem, hi = lo + len;
+	int overlap = 0;
+	FILE *f = fopen("/proc/self/smaps", "r");
+	if (!f) { return bvgraph_call_unsupported; }
+
+	*bytes = 0;
+	while (fgets(line, sizeof(line), f)) {
+		if (sscanf(line, "%llx-%llx ", &start, &end) == 2) {
+			overlap = start < hi && lo < end;
+		} else if (overlap && 
+			(sscanf(line, "AnonHugePages: %llu kB", &kb) == 1 ||
+			 sscanf(line, "FilePmdMapped: %llu kB", &kb) == 1)) {
+			unsigned long long olen = (end < hi ? end : hi) - (start > lo ? start : lo);
+			*bytes += (size_t)(kb*1024 < olen ? kb*1024 : olen);
+		}
+	}
+	fclose(f);
+	return (0);
+#else
+	*bytes = 0;
+	return bvgraph_call_unsupported;
+#endif /* __linux__ */
+}
+
+/**
+ * Open a uniquely named temporary file next to a file, so the file 
+ * can be written atomically: write the temporary file, then call 
+ * fcommit to rename it over the file, or fdiscard to remove it.  
+ * Readers then see either the old file or the complete new one.
+ *
+ * @param[in] filename the file to write
+ * @param[out] tmpname the name of the temporary file, which must be 
+ * released by fcommit or fdiscard
+ * @return the temporary file open for binary writing, or NULL on failure
+ */
+FILE* ftemp(const char *filename, char **tmpname)
+{
+	FILE *f = NULL;
+#ifdef HAVE_MMAP
+	int fd;
+	*tmpname = strappend(filename, (uint)strlen(filename), ".tmpXXXXXX", 10);
+	if (!*tmpname) { return NULL; }
+	fd = mkstemp(*tmpname);
+	if (fd >= 0) {
+		// mkstemp creates the file for the owner only
+		fchmod(fd, 0644);
+		f = fdopen(fd, "wb");
+		if (!f) { close(fd); remove(*tmpname); }
+	}
+#else
+	*tmpname = strappend(filename, (uint)strlen(filename), ".tmp", 4);
+	if (!*tmpname) { return NULL; }
+	f = fopen(*tmpname, "wb");
+#endif /* HAVE_MMAP */
+	if (!f) { free(*tmpname); *tmpname = NULL; }
+	return (f);
+}
+
+/**
+ * Close a temporary file from ftemp and rename it to the file.
+ *
+ * @param[in] f the temporary file
+ * @param[in] tmpname the name from ftemp, which is released
+ * @param[in] filename the file to replace
+ * @return 0 on success, bvgraph_call_io_error if the file could not 
+ * be written, in which case the temporary file is removed
+ */
+int fcommit(FILE *f, char *tmpname, const char *filename)
+{
+	int rval = 0;
+	if (fclose(f) != 0 || rename(tmpname, filename) != 0) {
+		remove(tmpname);
+		rval = bvgraph_call_io_error;
+	}
+	free(tmpname);
+	return (rval);
+}
+
+/**
+ * Close and remove a temporary file from ftemp.
+ *
+ * @param[in] f the temporary file
+ * @param[in] tmpname the name from ftemp, which is released
+ */
+void fdiscard(FILE *f, char *tmpname)
+{
+	fclose(f);
+	remove(tmpname);
+	free(tmpname);
+}
+
 /**
  * Create a vector of length n
  * @param[out] v the vector
@@ -278,3 +508,51 @@ int int_vector_free(bvgraph_int_vector* v)
 	return (0);
 }
 
+/**
+ * Create a 32-bit vector of length n
+ * @param[out] v the vector
+ * @param[in] n the length
+ * @return 0 on success
+ */
+
+int int32_vector_create(bvgraph_int32_vector* v, uint64_t n)
+{
+	v->elements = n;
+	v->a = malloc(sizeof(uint32_t)*n);
+	if (!v->a) { return bvgraph_call_out_of_memory; }
+	return (0);
+}
+
+/**
+ * Grow a 32-bit vector to at least length n, keeping its entries
+ * @param[out] v the vector
+ * @param[in] n length
+ * return 0 on success
+ */
+
+int int32_vector_ensure_size(bvgraph_int32_vector *v, uint64_t n)
+{
+	if (n > v->elements) {
+		uint32_t* newa = malloc(sizeof(uint32_t)*n);
+		if (!newa) { return bvgraph_call_out_of_memory; }
+		memcpy(newa, v->a, sizeof(uint32_t)*v->elements);
+		free(v->a);
+		v->a = newa;
+		v->elements = n;
+	}
+	return (0);
+}
+
+/**
+ * Free the 32-bit vector.
+ * @param[in] v the vector
+ * @return 0 on success
+ */
+
+int int32_vector_free(bvgraph_int32_vector* v)
+{
+	if (v->a) { free(v->a); v->a = NULL; }
+
+	return (0);
+}
+
@@ -0,0 +1,384 @@
+/*
+ * David Gleich
+ * Copyright, Stanford University, 2026
+ * 17 October 2026
+ */
+
+/**
+ * @file bitfile_codes_test.c
+ * Encode a set of numbers with each instantaneous code and check that the
+ * bitfile routines decode and skip them.
+ */
+
+/** History
+ *
+ * 2026-10-17: Initial version with delta codes
+ *             Added zeta_k codes for k = 1..7
+ *             Added Golomb and skewed Golomb codes
+ *             Fixed the skewed Golomb code to match dsiutils and added
+ *             reference bitstreams from its encoder
+ */
+
+#include "bitfile.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+// disable all of the unsafe operation warnings
+#ifdef _MSC_VER
+#define inline __inline
+#if _MSC_VER >= 1400
+#pragma warning ( push )
+#pragma warning ( disable: 4996 )
+#endif /* _MSC_VER >= 1400 */
+#endif /* _MSC_VER */
+
+/** A tiny MSB-first bit writer over a fixed buffer. */
+typedef struct bitwriter_tag {
+    unsigned char *buf;
+    size_t bufsize;
+    uint64_t nbits;
+} bitwriter;
+
+static void write_bit(bitwriter *w, int bit)
+{
+    if ((w->nbits>>3) >= w->bufsize) {
+        w->buf = realloc(w->buf, 2*w->bufsize);
+        memset(w->buf + w->bufsize, 0, w->bufsize);
+        w->bufsize *= 2;
+    }
+    if (bit) { w->buf[w->nbits>>3] |= (unsigned char)(0x80 >> (w->nbits&7)); }
+    w->nbits++;
+}
+
+static void write_int(bitwriter *w, uint64_t x, int len)
+{
+    while (len-- > 0) { write_bit(w, (int)((x >> len)&1)); }
+}
+
+static void write_unary(bitwriter *w, uint64_t x)
+{
+    while (x-- > 0) { write_bit(w, 0); }
+    write_bit(w, 1);
+}
+
+static int msb(uint64_t x)
+{
+    int m = -1;
+    while (x != 0) { x >>= 1; m++; }
+    return (m);
+}
+
+static void write_gamma(bitwriter *w, uint64_t x)
+{
+    int m = msb(++x);
+    write_unary(w, m);
+    write_int(w, x, m);
+}
+
+static void write_delta(bitwriter *w, uint64_t x)
+{
+    int m = msb(++x);
+    write_gamma(w, m);
+    write_int(w, x, m);
+}
+
+static void write_zeta(bitwriter *w, uint64_t x, int k)
+{
+    int h = msb(++x) / k;
+    uint64_t left = UINT64_C(1) << (h*k);
+    write_unary(w, h);
+    if (x - left < left) { write_int(w, x - left, h*k + k - 1); }
+    else { write_int(w, x, h*k + k); }
+}
+
+/** Minimal binary code of x in [0,z) */
+static void write_minimal_binary(bitwriter *w, uint64_t x, uint64_t z)
+{
+    int log2z = msb(z);
+    uint64_t m = (UINT64_C(2) << log2z) - z;
+    if (x < m) { write_int(w, x, log2z); }
+    else { write_int(w, x + m, log2z + 1); }
+}
+
+static void write_golomb(bitwriter *w, uint64_t x, int b)
+{
+    write_unary(w, x / b);
+    write_minimal_binary(w, x % b, b);
+}
+
+static void write_skewed_golomb(bitwriter *w, uint64_t x, int b)
+{
+    int i = msb(x / b + 1);
+    uint64_t M = ((UINT64_C(2) << i) - 1)*b;
+    uint64_t m = (M / (2*b))*b;
+    write_unary(w, i);
+    write_minimal_binary(w, x - m, M - m);
+}
+
+/** The codes exercised by this test */
+enum test_code { TEST_DELTA, TEST_ZETA, TEST_GOLOMB, TEST_SKEWED_GOLOMB };
+
+static const char* code_name(enum test_code c)
+{
+    switch (c) {
+        case TEST_DELTA: return "delta";
+        case TEST_ZETA: return "zeta";
+        case TEST_GOLOMB: return "golomb";
+        case TEST_SKEWED_GOLOMB: return "skewed golomb";
+    }
+    return "";
+}
+
+static void write_code(bitwriter *w, enum test_code c, int p, uint64_t x)
+{
+    switch (c) {
+        case TEST_DELTA: write_delta(w, x); break;
+        case TEST_ZETA: write_zeta(w, x, p); break;
+        case TEST_GOLOMB: write_golomb(w, x, p); break;
+        case TEST_SKEWED_GOLOMB: write_skewed_golomb(w, x, p); break;
+    }
+}
+
+static int64_t read_code(bitfile *bf, enum test_code c, int p)
+{
+    switch (c) {
+        case TEST_DELTA: return bitfile_read_delta(bf);
+        case TEST_ZETA: return bitfile_read_zeta(bf, p);
+        case TEST_GOLOMB: return bitfile_read_golomb(bf, p);
+        case TEST_SKEWED_GOLOMB: return bitfile_read_skewed_golomb(bf, p);
+    }
+    return (-1);
+}
+
+/** Build the list of test values: every short code and a spread of long
+ * codes up to 2^maxbits.
+ * @param[in] maxbits the largest power of two to test
+ * @param[out] n the number of values
+ * @return a malloc'ed array of values
+ */
+static uint64_t* test_values(int maxbits, int *n)
+{
+    int i, nshort = 5000, nvals = nshort + 3*maxbits;
+    uint64_t *vals = malloc(sizeof(uint64_t)*nvals);
+    for (i = 0; i < nshort; i++) { vals[i] = (uint64_t)i; }
+    for (i = 0; i < maxbits; i++) {
+        vals[nshort+3*i] = (UINT64_C(1) << (i+1)) - 1;
+        vals[nshort+3*i+1] = (UINT64_C(1) << (i+1));
+        vals[nshort+3*i+2] = (UINT64_C(1) << (i+1)) + 12345;
+    }
+    *n = nvals;
+    return (vals);
+}
+
+/** Decode all values and check the values and bit positions.
+ * @return 0 on success
+ */
+static int check_read(bitfile *bf, enum test_code c, int p, 
+                      const uint64_t *vals, int n, const uint64_t *ends)
+{
+    int i;
+    for (i = 0; i < n; i++) {
+        uint64_t v = (uint64_t)read_code(bf, c, p);
+        if (v != vals[i] || (uint64_t)bitfile_tell(bf) != ends[i]) {
+            fprintf(stderr, "\n ERROR on %s(%i) %i : read %llu, should be %llu\n",
+                code_name(c), p, i, (unsigned long long)v, 
+                (unsigned long long)vals[i]);
+            return (-1);
+        }
+    }
+    return (0);
+}
+
+/** Re-read the delta codes alternating skips and reads.
+ * @return 0 on success
+ */
+static int check_delta_skip(bitfile *bf, const uint64_t *vals, int n,
+                            const uint64_t *ends)
+{
+    int i;
+    for (i = 0; i + 3 < n; i += 4) {
+        bitfile_skip_deltas(bf, 3);
+        if ((uint64_t)bitfile_tell(bf) != ends[i+2]) {
+            fprintf(stderr, "\n ERROR skipping deltas at %i\n", i);
+            return (-1);
+        }
+        if ((uint64_t)bitfile_read_delta(bf) != vals[i+3]) {
+            fprintf(stderr, "\n ERROR on delta %i after skip\n", i+3);
+            return (-1);
+        }
+    }
+    return (0);
+}
+
+/** A skewed Golomb bitstream written by the reference encoder,
+ * OutputBitStream.writeSkewedGolomb in dsiutils, and padded with zeros
+ * to a byte boundary.
+ */
+typedef struct skewed_golomb_reference_tag {
+    int b;
+    int n;
+    uint64_t vals[16];
+    unsigned char bytes[16];
+} skewed_golomb_reference;
+
+static const skewed_golomb_reference skewed_golomb_refs[] = {
+    {1, 10, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9},
+     {0xa6, 0x42, 0x98, 0xe2, 0x04, 0x8a}},
+    {3, 16, {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 40},
+     {0xb7, 0x45, 0x63, 0x5c, 0xf2, 0x09, 0x28, 0xb3, 0x06, 0x47, 0x60}},
+    {5, 4, {0, 7, 23, 100},
+     {0x8a, 0x30, 0x16, 0x40}},
+    {2000, 5, {0, 1999, 2000, 5999, 6000},
+     {0x80, 0x1f, 0xfe, 0x80, 0x07, 0xff, 0xc8, 0x00, 0x00}},
+};
+
+/** Decode the reference skewed Golomb bitstreams.
+ * @return 0 on success
+ */
+static int check_skewed_golomb_reference(void)
+{
+    int i, j;
+    int nrefs = sizeof(skewed_golomb_refs)/sizeof(skewed_golomb_reference);
+    bitfile bfstruct, *bf = &bfstruct;
+    for (i = 0; i < nrefs; i++) {
+        const skewed_golomb_reference *r = &skewed_golomb_refs[i];
+        bitfile_map((unsigned char*)r->bytes, sizeof(r->bytes), bf);
+        for (j = 0; j < r->n; j++) {
+            uint64_t v = (uint64_t)bitfile_read_skewed_golomb(bf, r->b);
+            if (v != r->vals[j]) {
+                fprintf(stderr, 
+                    "\n ERROR on reference skewed golomb(%i) %i : "
+                    "read %llu, should be %llu\n", r->b, j, 
+                    (unsigned long long)v, (unsigned long long)r->vals[j]);
+                bitfile_close(bf);
+                return (-1);
+            }
+        }
+        bitfile_close(bf);
+    }
+    return (0);
+}
+
+/** Encode the test values with a code and decode them from memory 
+ * and from a file.
+ * @param[in] c the code
+ * @param[in] p the parameter of the code
+ * @return 0 on success
+ */
+int test_code(enum test_code c, int p)
+{
+    // the slow zeta path reads at most 63 bits at once, and Golomb
+    // codes of large values are very long unary codes
+    int i, n, rval = 0;
+    uint64_t *vals = test_values(c == TEST_DELTA ? 62 : 
+        (c == TEST_GOLOMB ? 12 : (c == TEST_SKEWED_GOLOMB ? 40 : 48)), &n);
+    uint64_t *ends = malloc(sizeof(uint64_t)*n);
+    bitwriter w;
+    bitfile bfstruct, *bf = &bfstruct;
+    FILE *f;
+
+    w.bufsize = 4096;
+    w.buf = calloc(w.bufsize, 1);
+    w.nbits = 0;
+    for (i = 0; i < n; i++) {
+        write_code(&w, c, p, vals[i]);
+        ends[i] = w.nbits;
+    }
+
+    bitfile_map(w.buf, (w.nbits+7)/8, bf);
+    rval |= check_read(bf, c, p, vals, n, ends);
+    bitfile_close(bf);
+
+    if (c == TEST_DELTA) {
+        bitfile_map(w.buf, (w.nbits+7)/8, bf);
+        rval |= check_delta_skip(bf, vals, n, ends);
+        bitfile_close(bf);
+    }
+
+    f = tmpfile();
+    if (f) {
+        fwrite(w.buf, 1, (w.nbits+7)/8, f);
+        fseek(f, 0, SEEK_SET);
+        bitfile_open(f, bf);
+        rval |= check_read(bf, c, p, vals, n, ends);
+        bitfile_close(bf);
+        fclose(f);
+    }
+
+    free(w.buf);
+    free(ends);
+    free(vals);
+    return (rval);
+}
+
+int main(int argc, char **argv)
+{
+    int i, k, rval = 0;
+    int bs[] = {1, 2, 3, 5, 7, 16, 100, 1000, 1024, 5000};
+    int nbs = sizeof(bs)/sizeof(int);
+
+    printf("Testing delta codes ... ");
+    rval = test_code(TEST_DELTA, 0);
+    if (rval != 0) {
+        fprintf(stderr, "FAILED!\n");
+        return (-1);
+    } else {
+        printf("passed!\n");
+    }
+
+    printf("Testing zeta codes ... ");
+    for (k = 1; k <= 8; k++) {
+        // once on the slow path, once with the table
+        rval |= test_code(TEST_ZETA, k);
+        if (k <= BITFILE_MAX_ZETA_TABLE_K && bitfile_zeta_table(k) == NULL) {
+            rval = -1;
+        }
+        rval |= test_code(TEST_ZETA, k);
+    }
+    if (rval != 0) {
+        fprintf(stderr, "FAILED!\n");
+        return (-1);
+    } else {
+        printf("passed!\n");
+    }
+
+    printf("Testing reference skewed Golomb codes ... ");
+    // once on the slow path, once with the tables
+    rval |= check_skewed_golomb_reference();
+    for (i = 0; i < nbs; i++) {
+        if (bs[i] <= BITFILE_MAX_GOLOMB_TABLE_B && 
+            bitfile_skewed_golomb_table(bs[i]) == NULL) {
+            rval = -1;
+        }
+    }
+    rval |= check_skewed_golomb_reference();
+    if (rval != 0) {
+        fprintf(stderr, "FAILED!\n");
+        return (-1);
+    } else {
+        printf("passed!\n");
+    }
+
+    printf("Testing Golomb codes ... ");
+    for (i = 0; i < nbs; i++) {
+        rval |= test_code(TEST_GOLOMB, bs[i]);
+        rval |= test_code(TEST_SKEWED_GOLOMB, bs[i]);
+        if (bs[i] <= BITFILE_MAX_GOLOMB_TABLE_B && 
+            (bitfile_golomb_table(bs[i]) == NULL || 
+             bitfile_skewed_golomb_table(bs[i]) == NULL)) {
+            rval = -1;
+        }
+        rval |= test_code(TEST_GOLOMB, bs[i]);
+        rval |= test_code(TEST_SKEWED_GOLOMB, bs[i]);
+    }
+    if (rval != 0) {
+        fprintf(stderr, "FAILED!\n");
+        return (-1);
+    } else {
+        printf("passed!\n");
+    }
+
+    return (0);
+}
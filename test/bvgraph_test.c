@@ -9,11 +9,62 @@
  * Read a bvgraph from a file and write its data to stdout
  */
 
+/** History
+ *
+ * 2026-10-17: Check memory mapped and huge page loads against a 
+ *             regular load
+ *             Check random access with Elias-Fano offsets
+ *             Check random access with offset_step > 1
+ *             Check bvgraph_iterator32 against bvgraph_iterator
+ *             Check bvgraph_foreach and bvgraph_foreach_batch
+ *             Check bvgraph_iterator_next_batch
+ *             Check bvgraph_async_iterator
+ *             Check the outdegree scans and the outdegree cache
+ *             Check random access with the successor cache
+ *             Check bvgraph_random_successors_batch
+ *             Check bvgraph_has_arc
+ *             Include bvgraphfun.h for bvgraph_sum_row
+ */
+
 #include "bvgraph.h"
+#include "bvgraphfun.h"
 #include <string.h>
 #include <stdlib.h>
 #include <inttypes.h>
 
+/** The state of the foreach checks: the successors of every node in
+ * compressed sparse row form, and the next node expected */
+struct foreach_check {
+    int64_t *rowstart;
+    int64_t *links;
+    int64_t next;
+};
+
+static int check_visit(void *ctx, int64_t x, const int64_t *links, uint64_t d)
+{
+    struct foreach_check *c = ctx;
+    uint64_t i;
+    if (x != c->next++ || (int64_t)d != c->rowstart[x+1] - c->rowstart[x]) { 
+        return (-1); 
+    }
+    for (i = 0; i < d; i++) {
+        if (links[i] != c->links[c->rowstart[x] + i]) { return (-1); }
+    }
+    return (0);
+}
+
+static int check_batch_visit(void *ctx, int64_t first, int64_t count,
+                             const uint64_t *start, const int64_t *links)
+{
+    int64_t k;
+    for (k = 0; k < count; k++) {
+        if (check_visit(ctx, first + k, &links[start[k]], start[k+1] - start[k])) {
+            return (-1);
+        }
+    }
+    return (0);
+}
+
 // disable all of the unsafe operation warnings
 #ifdef _MSC_VER
 #define inline __inline
@@ -92,8 +143,499 @@ int main(int argc, char **argv)
         free(colsum);
         free(colsum2);
     }
+    {
+        // the 32-bit iterator must give the same successors
+        bvgraph_iterator iter;
+        bvgraph_iterator32 iter32;
+        int64_t *links = NULL;
+        uint32_t *links32 = NULL;
+        uint64_t d, d32;
+        for (bvgraph_nonzero_iterator(g, &iter), 
+             bvgraph_nonzero_iterator32(g, &iter32); 
+             bvgraph_iterator_valid(&iter); 
+             bvgraph_iterator_next(&iter), bvgraph_iterator32_next(&iter32))
+        {
+            bvgraph_iterator_outedges(&iter, &links, &d);
+            bvgraph_iterator32_outedges(&iter32, &links32, &d32);
+            if (!bvgraph_iterator32_valid(&iter32) || iter.curr != iter32.curr 
+                || d != d32) {
+                fprintf(stderr, "error, 32-bit iterator differs on node %"PRId64"\n", 
+                    iter.curr);
+                return (-1);
+            }
+            for (i = 0; i < d; i++) {
+                if (links[i] != (int64_t)links32[i]) {
+                    fprintf(stderr, "error, 32-bit successor %"PRId64" of node %"PRId64" differs\n", 
+                        i, iter.curr);
+                    return (-1);
+                }
+            }
+        }
+        if (bvgraph_iterator32_valid(&iter32)) {
+            fprintf(stderr, "error, 32-bit iterator has extra nodes\n");
+            return (-1);
+        }
+        bvgraph_iterator_free(&iter);
+        bvgraph_iterator32_free(&iter32);
+    }
+    {
+        // the visitors must see the same successors as the iterator, 
+        // over the whole graph and from the middle of the graph
+        bvgraph fgraph = {0};
+        bvgraph_iterator iter;
+        struct foreach_check c;
+        int64_t *links = NULL;
+        uint64_t d;
+        int64_t ranges[4][2];
+        int ri;
+        c.rowstart = malloc(sizeof(int64_t)*(g->n+1));
+        c.links = malloc(sizeof(int64_t)*(g->m+1));
+        c.rowstart[0] = 0;
+        for (bvgraph_nonzero_iterator(g, &iter); 
+             bvgraph_iterator_valid(&iter); 
+             bvgraph_iterator_next(&iter))
+        {
+            bvgraph_iterator_outedges(&iter, &links, &d);
+            c.rowstart[iter.curr+1] = c.rowstart[iter.curr] + (int64_t)d;
+            memcpy(&c.links[c.rowstart[iter.curr]], links, sizeof(int64_t)*d);
+        }
+        bvgraph_iterator_free(&iter);
+        rval = bvgraph_load(&fgraph, filename, filenamelen, 1);
+        if (rval) { perror("error with offsets load!"); return (-1); }
+        ranges[0][0] = 0; ranges[0][1] = g->n;
+        ranges[1][0] = g->n/3; ranges[1][1] = 2*g->n/3;
+        ranges[2][0] = g->n-1; ranges[2][1] = g->n;
+        ranges[3][0] = g->n/2; ranges[3][1] = g->n/2;
+        for (ri = 0; ri < 4; ri++) {
+            c.next = ranges[ri][0];
+            rval = bvgraph_foreach(&fgraph, ranges[ri][0], ranges[ri][1], 
+                check_visit, &c);
+            if (rval || c.next != ranges[ri][1]) {
+                fprintf(stderr, "error, bvgraph_foreach differs on [%"PRId64",%"PRId64")\n",
+                    ranges[ri][0], ranges[ri][1]);
+                return (-1);
+            }
+            c.next = ranges[ri][0];
+            rval = bvgraph_foreach_batch(&fgraph, ranges[ri][0], ranges[ri][1], 
+                7, check_batch_visit, &c);
+            if (rval || c.next != ranges[ri][1]) {
+                fprintf(stderr, "error, bvgraph_foreach_batch differs on [%"PRId64",%"PRId64")\n",
+                    ranges[ri][0], ranges[ri][1]);
+                return (-1);
+            }
+        }
+        // without offsets, the nodes before the range are skipped
+        c.next = ranges[1][0];
+        rval = bvgraph_foreach(g, ranges[1][0], ranges[1][1], check_visit, &c);
+        if (rval || c.next != ranges[1][1]) {
+            fprintf(stderr, "error, bvgraph_foreach differs without offsets\n");
+            return (-1);
+        }
+        {
+            // the chunks must cover the graph
+            bvgraph_csr_chunk chunk;
+            uint64_t max_edges = (uint64_t)g->max_outd + 3;
+            chunk.rowstart = malloc(sizeof(uint64_t)*6);
+            chunk.links = malloc(sizeof(int64_t)*max_edges);
+            c.next = 0;
+            bvgraph_nonzero_iterator(g, &iter);
+            while ((rval = bvgraph_iterator_next_batch(&iter, 5, max_edges, &chunk)) == 0 
+                   && chunk.nodes > 0) {
+                if (chunk.first != c.next || chunk.nodes > 5 || chunk.edges > max_edges ||
+                    check_batch_visit(&c, chunk.first, chunk.nodes, chunk.rowstart, 
+                        chunk.links)) {
+                    rval = -1;
+                    break;
+                }
+            }
+            bvgraph_iterator_free(&iter);
+            if (rval || c.next != g->n) {
+                fprintf(stderr, "error, bvgraph_iterator_next_batch differs\n");
+                return (-1);
+            }
+            bvgraph_nonzero_iterator(g, &iter);
+            while (iter.curr_outd == 0) { bvgraph_iterator_next(&iter); }
+            if (bvgraph_iterator_next_batch(&iter, 5, 0, &chunk) != 
+                    bvgraph_call_buffer_too_small || chunk.nodes != 0) {
+                fprintf(stderr, "error, bvgraph_iterator_next_batch overflows\n");
+                return (-1);
+            }
+            bvgraph_iterator_free(&iter);
+            free(chunk.rowstart);
+            free(chunk.links);
+        }
+        {
+            // the async iterator must give the same successors for any depth,
+            // and stop cleanly in the middle of the graph
+            int depths[] = {1, 2, 4};
+            int di;
+            for (di = 0; di < 3; di++) {
+                bvgraph_async_iterator aiter;
+                c.next = 0;
+                rval = bvgraph_async_nonzero_iterator(g, &aiter, depths[di]);
+                for (; rval == 0 && bvgraph_async_iterator_valid(&aiter); 
+                     bvgraph_async_iterator_next(&aiter)) 
+                {
+                    bvgraph_async_iterator_outedges(&aiter, &links, &d);
+                    rval = check_visit(&c, aiter.curr, links, d);
+                }
+                bvgraph_async_iterator_free(&aiter);
+                if (rval || c.next != g->n) {
+                    fprintf(stderr, "error, async iterator with depth %i differs\n", 
+                        depths[di]);
+                    return (-1);
+                }
+                rval = bvgraph_async_nonzero_iterator(g, &aiter, depths[di]);
+                if (rval == 0) { rval = bvgraph_async_iterator_next(&aiter); }
+                bvgraph_async_iterator_free(&aiter);
+                if (rval) {
+                    fprintf(stderr, "error, async iterator with depth %i fails\n", 
+                        depths[di]);
+                    return (-1);
+                }
+            }
+        }
+        bvgraph_close(&fgraph);
+        free(c.rowstart);
+        free(c.links);
+    }
     bvgraph_close(g);
 
+    {
+        // a graph loaded with any flags must have the same edges and offsets 
+        int flags[] = {BVGRAPH_LOAD_MMAP, BVGRAPH_LOAD_MMAP|BVGRAPH_LOAD_POPULATE,
+            BVGRAPH_LOAD_HUGEPAGES, BVGRAPH_LOAD_HUGEPAGES|BVGRAPH_LOAD_POPULATE,
+            BVGRAPH_LOAD_EF_OFFSETS, BVGRAPH_LOAD_MMAP|BVGRAPH_LOAD_EF_OFFSETS};
+        int fi;
+        for (fi = 0; fi < (int)(sizeof(flags)/sizeof(int)); fi++) {
+            bvgraph mgraph = {0};
+            bvgraph_iterator iter, miter;
+            bvgraph_random_iterator ri, mri;
+            int64_t *links = NULL, *mlinks = NULL;
+            uint64_t d, md;
+            size_t hmem, hoff;
+            rval = bvgraph_load_external(&mgraph, filename, filenamelen, 1,
+                NULL, 0, NULL, 0, flags[fi]);
+            if (rval == bvgraph_call_unsupported) {
+                printf("load flags %i are not supported\n", flags[fi]);
+                continue;
+            } else if (rval) { 
+                perror("error with flagged load!"); return (-1); 
+            }
+            rval = bvgraph_load(g, filename, filenamelen, 1);
+            if (rval) { perror("error with offsets load!"); return (-1); }
+            for (i = 0; mgraph.offsets && i < g->n; i++) {
+                if (g->offsets[i] != mgraph.offsets[i]) {
+                    fprintf(stderr, "error, offset %"PRId64" differs\n", i);
+                    return (-1);
+                }
+            }
+            for (bvgraph_nonzero_iterator(g, &iter), 
+                 bvgraph_nonzero_iterator(&mgraph, &miter); 
+                 bvgraph_iterator_valid(&iter); 
+                 bvgraph_iterator_next(&iter), bvgraph_iterator_next(&miter))
+            {
+                bvgraph_iterator_outedges(&iter, &links, &d);
+                bvgraph_iterator_outedges(&miter, &mlinks, &md);
+                if (d != md || memcmp(links, mlinks, sizeof(int64_t)*d) != 0) {
+                    fprintf(stderr, "error, node %"PRId64" differs with flags %i\n", 
+                        iter.curr, flags[fi]);
+                    return (-1);
+                }
+            }
+            bvgraph_iterator_free(&iter);
+            bvgraph_iterator_free(&miter);
+            bvgraph_random_access_iterator(g, &ri);
+            bvgraph_random_access_iterator(&mgraph, &mri);
+            for (i = g->n - 1; i >= 0; i--) {
+                bvgraph_random_successors(&ri, i, &links, &d);
+                bvgraph_random_successors(&mri, i, &mlinks, &md);
+                if (d != md || memcmp(links, mlinks, sizeof(int64_t)*d) != 0) {
+                    fprintf(stderr, "error, random node %"PRId64" differs with flags %i\n", 
+                        i, flags[fi]);
+                    return (-1);
+                }
+            }
+            bvgraph_random_free(&ri);
+            bvgraph_random_free(&mri);
+            if (bvgraph_hugepage_usage(&mgraph, &hmem, &hoff) == 0) {
+                printf("the graph %s with load flags %i matches "
+                    "(%zu + %zu bytes on huge pages)\n", filename, flags[fi], hmem, hoff);
+            } else {
+                printf("the graph %s with load flags %i matches\n", filename, flags[fi]);
+            }
+            bvgraph_close(g);
+            bvgraph_close(&mgraph);
+        }
+    }
+
+    {
+        // random access with sampled offsets must match full offsets
+        int steps[] = {2, 8, 16, 32};
+        int si, ef;
+        for (si = 0; si < (int)(sizeof(steps)/sizeof(int)); si++) {
+            for (ef = 0; ef < 2; ef++) {
+                bvgraph sgraph = {0};
+                bvgraph_random_iterator ri, sri;
+                int64_t *links = NULL, *slinks = NULL;
+                uint64_t d, sd, sd2;
+                size_t offsetbuf;
+                rval = bvgraph_load_external(&sgraph, filename, filenamelen, steps[si],
+                    NULL, 0, NULL, 0, ef ? BVGRAPH_LOAD_EF_OFFSETS : 0);
+                if (rval) { perror("error with sampled offsets load!"); return (-1); }
+                rval = bvgraph_load(g, filename, filenamelen, 1);
+                if (rval) { perror("error with offsets load!"); return (-1); }
+                bvgraph_required_memory(g, steps[si], NULL, &offsetbuf);
+                bvgraph_random_access_iterator(g, &ri);
+                bvgraph_random_access_iterator(&sgraph, &sri);
+                // visit the nodes in a scrambled order
+                for (i = 0; i < g->n; i++) {
+                    int64_t x = (i*7919) % g->n;
+                    bvgraph_random_successors(&ri, x, &links, &d);
+                    rval = bvgraph_random_successors(&sri, x, &slinks, &sd);
+                    rval |= bvgraph_random_outdegree(&sri, x, &sd2);
+                    if (rval || d != sd || d != sd2 || 
+                        memcmp(links, slinks, sizeof(int64_t)*d) != 0) {
+                        fprintf(stderr, "error, random node %"PRId64" differs with "
+                            "offset_step %i\n", x, steps[si]);
+                        return (-1);
+                    }
+                }
+                bvgraph_random_free(&ri);
+                bvgraph_random_free(&sri);
+                if (ef) {
+                    printf("the graph %s with offset_step %i and Elias-Fano offsets matches\n",
+                        filename, steps[si]);
+                } else {
+                    printf("the graph %s with offset_step %i matches (%zu offset bytes)\n",
+                        filename, steps[si], offsetbuf);
+                }
+                bvgraph_close(g);
+                bvgraph_close(&sgraph);
+            }
+        }
+    }
+
+    {
+        // random access with the successor cache must match random access
+        // without it, with a budget that forces evictions and one that 
+        // holds the graph
+        size_t budgets[] = {4096, (size_t)1 << 26};
+        int bi;
+        for (bi = 0; bi < (int)(sizeof(budgets)/sizeof(size_t)); bi++) {
+            bvgraph sgraph = {0};
+            bvgraph_random_iterator ri, cri;
+            int64_t *links = NULL, *clinks = NULL;
+            uint64_t d, cd, cd2;
+            rval = bvgraph_load(g, filename, filenamelen, 1);
+            if (rval) { perror("error with offsets load!"); return (-1); }
+            rval = bvgraph_load(&sgraph, filename, filenamelen, 8);
+            if (rval) { perror("error with sampled offsets load!"); return (-1); }
+            bvgraph_random_access_iterator(g, &ri);
+            bvgraph_random_access_iterator(&sgraph, &cri);
+            bvgraph_random_cache_size(&cri, budgets[bi]);
+            // visit every node twice in a scrambled order
+            for (i = 0; i < 2*g->n; i++) {
+                int64_t x = (i*7919) % g->n;
+                bvgraph_random_successors(&ri, x, &links, &d);
+                rval = bvgraph_random_successors(&cri, x, &clinks, &cd);
+                rval |= bvgraph_random_outdegree(&cri, x, &cd2);
+                if (rval || d != cd || d != cd2 || 
+                    memcmp(links, clinks, sizeof(int64_t)*d) != 0 ||
+                    cri.cache.bytes > budgets[bi]) {
+                    fprintf(stderr, "error, random node %"PRId64" differs with "
+                        "a cache of %zu bytes\n", x, budgets[bi]);
+                    return (-1);
+                }
+            }
+            // the second visit of each node hits the larger cache
+            if (bi == 1 && g->n > 0 && cri.cache.hits < (uint64_t)g->n) {
+                fprintf(stderr, "error, no hits in a cache of %zu bytes\n", 
+                    budgets[bi]);
+                return (-1);
+            }
+            printf("the graph %s with a cache of %zu bytes matches "
+                "(%"PRIu64" hits, %"PRIu64" misses)\n", filename, budgets[bi],
+                cri.cache.hits, cri.cache.misses);
+            bvgraph_random_free(&ri);
+            bvgraph_random_free(&cri);
+            bvgraph_close(g);
+            bvgraph_close(&sgraph);
+        }
+    }
+
+    {
+        // batches of queries in a scrambled order, with repeated nodes, 
+        // must match one query at a time
+        int steps[] = {1, 8};
+        int si;
+        for (si = 0; si < (int)(sizeof(steps)/sizeof(int)); si++) {
+            bvgraph_random_iterator ri, bri;
+            bvgraph_csr_chunk chunk;
+            int64_t *nodes, *links;
+            uint64_t d;
+            size_t k = 0, j;
+            rval = bvgraph_load(g, filename, filenamelen, steps[si]);
+            if (rval) { perror("error with offsets load!"); return (-1); }
+            bvgraph_random_access_iterator(g, &ri);
+            bvgraph_random_access_iterator(g, &bri);
+            nodes = malloc(sizeof(int64_t)*(2*g->n+1));
+            for (i = 0; i < g->n + g->n/2; i++) { nodes[k++] = (i*7919) % g->n; }
+            chunk.rowstart = malloc(sizeof(uint64_t)*(k+1));
+            chunk.links = malloc(sizeof(int64_t)*1);
+            rval = bvgraph_random_successors_batch(&bri, nodes, k, 1, &chunk);
+            if (g->m > 1 && rval != bvgraph_call_buffer_too_small) {
+                fprintf(stderr, "error, batch did not report a small buffer\n");
+                return (-1);
+            }
+            free(chunk.links);
+            chunk.links = malloc(sizeof(int64_t)*(chunk.edges > 0 ? chunk.edges : 1));
+            rval = bvgraph_random_successors_batch(&bri, nodes, k, chunk.edges, &chunk);
+            if (rval || chunk.nodes != (int64_t)k) {
+                fprintf(stderr, "error, batch failed with offset_step %i\n", steps[si]);
+                return (-1);
+            }
+            for (j = 0; j < k; j++) {
+                bvgraph_random_successors(&ri, nodes[j], &links, &d);
+                if (chunk.rowstart[j+1] - chunk.rowstart[j] != d ||
+                    memcmp(links, &chunk.links[chunk.rowstart[j]], 
+                        sizeof(int64_t)*d) != 0) {
+                    fprintf(stderr, "error, batch node %"PRId64" differs with "
+                        "offset_step %i\n", nodes[j], steps[si]);
+                    return (-1);
+                }
+            }
+            printf("the graph %s with a batch of %zu queries and offset_step %i matches\n",
+                filename, k, steps[si]);
+            free(nodes);
+            free(chunk.rowstart);
+            free(chunk.links);
+            bvgraph_random_free(&ri);
+            bvgraph_random_free(&bri);
+            bvgraph_close(g);
+        }
+    }
+
+    {
+        // bvgraph_has_arc must find every successor and nothing else, 
+        // with full and sampled offsets and with the successor cache
+        int steps[] = {1, 8, 8};
+        int si;
+        for (si = 0; si < (int)(sizeof(steps)/sizeof(int)); si++) {
+            bvgraph_random_iterator ri, ari;
+            int64_t *links, *copy = NULL, y;
+            uint64_t d, j;
+            int arc, expected;
+            rval = bvgraph_load(g, filename, filenamelen, steps[si]);
+            if (rval) { perror("error with offsets load!"); return (-1); }
+            bvgraph_random_access_iterator(g, &ri);
+            bvgraph_random_access_iterator(g, &ari);
+            if (si == 2) { bvgraph_random_cache_size(&ari, (size_t)1 << 20); }
+            copy = malloc(sizeof(int64_t)*(g->n+1));
+            for (i = 0; i < g->n && rval == 0; i++) {
+                bvgraph_random_successors(&ri, i, &links, &d);
+                memcpy(copy, links, sizeof(int64_t)*d);
+                // the successors, their neighbors and a few other targets
+                for (j = 0; j < 3*d + 4 && rval == 0; j++) {
+                    uint64_t k;
+                    if (j < 3*d) { y = copy[j/3] + (int64_t)(j%3) - 1; }
+                    else { y = ((i + (int64_t)j)*7919) % g->n; }
+                    if (y < 0 || y >= g->n) { continue; }
+                    for (expected = 0, k = 0; k < d; k++) {
+                        if (copy[k] == y) { expected = 1; }
+                    }
+                    rval = bvgraph_has_arc(&ari, i, y, &arc);
+                    if (rval || arc != expected) {
+                        fprintf(stderr, "error, has_arc(%"PRId64", %"PRId64") is %i "
+                            "with offset_step %i\n", i, y, arc, steps[si]);
+                        return (-1);
+                    }
+                }
+            }
+            printf("the graph %s has the same arcs with offset_step %i%s\n", 
+                filename, steps[si], si == 2 ? " and a cache" : "");
+            free(copy);
+            bvgraph_random_free(&ri);
+            bvgraph_random_free(&ari);
+            bvgraph_close(g);
+        }
+    }
+
+    {
+        // the outdegree scans must match the iterator with every kind of
+        // offsets, over the whole graph and over ranges
+        int steps[] = {-1, 0, 1, 2, 16};
+        int si;
+        bvgraph_iterator iter;
+        uint64_t d;
+        int64_t *outd, *soutd;
+        double *rowsum;
+        rval = bvgraph_load(g, filename, filenamelen, 0);
+        if (rval) { perror("error with full load!"); return (-1); }
+        outd = malloc(sizeof(int64_t)*(g->n+1));
+        soutd = malloc(sizeof(int64_t)*(g->n+1));
+        rowsum = malloc(sizeof(double)*(g->n+1));
+        for (bvgraph_nonzero_iterator(g, &iter); 
+             bvgraph_iterator_valid(&iter); 
+             bvgraph_iterator_next(&iter))
+        {
+            bvgraph_iterator_outedges(&iter, NULL, &d);
+            outd[iter.curr] = (int64_t)d;
+        }
+        bvgraph_iterator_free(&iter);
+        bvgraph_close(g);
+        for (si = 0; si < (int)(sizeof(steps)/sizeof(int)); si++) {
+            int64_t ranges[3][2];
+            int ri, cached;
+            rval = bvgraph_load(g, filename, filenamelen, steps[si]);
+            if (rval) { perror("error with outdegree load!"); return (-1); }
+            ranges[0][0] = 0; ranges[0][1] = g->n;
+            ranges[1][0] = g->n/3; ranges[1][1] = 2*g->n/3;
+            ranges[2][0] = g->n > 0 ? g->n-1 : 0; ranges[2][1] = g->n;
+            for (cached = 0; cached < 2; cached++) {
+                if (cached && bvgraph_cache_outdegrees(g)) {
+                    fprintf(stderr, "error, could not cache the outdegrees\n");
+                    return (-1);
+                }
+                for (ri = 0; ri < 3; ri++) {
+                    int64_t n = ranges[ri][1] - ranges[ri][0];
+                    rval = bvgraph_outdegrees_range(g, ranges[ri][0], 
+                        ranges[ri][1], soutd);
+                    if (rval || memcmp(soutd, &outd[ranges[ri][0]], 
+                            sizeof(int64_t)*n) != 0) {
+                        fprintf(stderr, "error, outdegrees of %"PRId64" to %"PRId64
+                            " differ with offset_step %i\n", 
+                            ranges[ri][0], ranges[ri][1], steps[si]);
+                        return (-1);
+                    }
+                }
+                rval = bvgraph_sum_row(g, rowsum);
+                for (i = 0; i < g->n && rval == 0; i++) {
+                    if (rowsum[i] != (double)outd[i]) { rval = -1; }
+                }
+                if (rval) {
+                    fprintf(stderr, "error, row sums differ with offset_step %i\n",
+                        steps[si]);
+                    return (-1);
+                }
+            }
+            if (g->max_outd <= 0 && g->m > 0) {
+                fprintf(stderr, "error, the outdegree cache did not set max_outd\n");
+                return (-1);
+            }
+            if (g->n > 0 && (bvgraph_outdegree(g, g->n-1, &d) || 
+                    (int64_t)d != outd[g->n-1])) {
+                fprintf(stderr, "error, bvgraph_outdegree differs with the cache\n");
+                return (-1);
+            }
+            bvgraph_close(g);
+        }
+        printf("the outdegrees of %s match\n", filename);
+        free(outd);
+        free(soutd);
+        free(rowsum);
+    }
+
     for (i = 0; i < 10000000; i++) {
         rval = bvgraph_load(g, filename, filenamelen, 0);
         bvgraph_close(g);
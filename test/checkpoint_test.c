@@ -0,0 +1,297 @@
+/*
+ * David Gleich
+ * Copyright, Stanford University, 2026
+ * 17 October 2026
+ */
+
+/**
+ * @file checkpoint_test.c
+ * Save iterator checkpoints for a copy of a graph, load them into a
+ * graph without offsets, and check that iterators moved with
+ * bvgraph_iterator_seek and parallel iterators started from the
+ * checkpoints match random access.
+ */
+
+/** History
+ *
+ * 2026-10-17: Initial version
+ *             Check that corrupt checkpoints do not load
+ */
+
+#include "bvgraph.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+// disable all of the unsafe operation warnings
+#ifdef _MSC_VER
+#define inline __inline
+#if _MSC_VER >= 1400
+#pragma warning ( push )
+#pragma warning ( disable: 4996 )
+#endif /* _MSC_VER >= 1400 */
+#endif /* _MSC_VER */
+
+/** The base name for the copy of the graph */
+static const char *copyname = "checkpoint_tmp";
+
+/** Copy a file of the graph to the same file of the copy.
+ * @return 0 on success
+ */
+static int copy_graph_file(const char *basename, const char *ext)
+{
+    char src[1024], dst[1024];
+    unsigned char buf[65536];
+    size_t len;
+    FILE *f, *g;
+    sprintf(src, "%s%s", basename, ext);
+    sprintf(dst, "%s%s", copyname, ext);
+    f = fopen(src, "rb");
+    if (!f) { return (-1); }
+    g = fopen(dst, "wb");
+    if (!g) { fclose(f); return (-1); }
+    while ((len = fread(buf, 1, sizeof(buf), f)) > 0) {
+        if (fwrite(buf, 1, len, g) != len) { break; }
+    }
+    fclose(f);
+    fclose(g);
+    return (0);
+}
+
+/** The size of a file of the copy, or 0 if it does not exist */
+static long copy_file_size(const char *ext)
+{
+    char name[1024];
+    long size = 0;
+    FILE *f;
+    sprintf(name, "%s%s", copyname, ext);
+    f = fopen(name, "rb");
+    if (f) {
+        fseek(f, 0, SEEK_END);
+        size = ftell(f);
+        fclose(f);
+    }
+    return (size);
+}
+
+/** Replace the k-th value of the checkpoints of the copy.
+ * @return the old value
+ */
+static int64_t poke_checkpoints(long k, int64_t value)
+{
+    char name[1024];
+    int64_t old = 0;
+    FILE *f;
+    sprintf(name, "%s.checkpoints", copyname);
+    f = fopen(name, "r+b");
+    if (f) {
+        fseek(f, k*(long)sizeof(int64_t), SEEK_SET);
+        if (fread(&old, sizeof(int64_t), 1, f) == 1) {
+            fseek(f, k*(long)sizeof(int64_t), SEEK_SET);
+            fwrite(&value, sizeof(int64_t), 1, f);
+        }
+        fclose(f);
+    }
+    return (old);
+}
+
+/** Check that checkpoints with a wrong count, a decreasing index or a
+ * negative outdegree do not load.
+ * @return 0 on success
+ */
+static int check_corrupt(void)
+{
+    // the header has 6 values and the index count+1 values
+    bvgraph copy = {0};
+    long count, values[3];
+    int k, rval = 0;
+    bvgraph_load(&copy, copyname, (unsigned int)strlen(copyname), 0);
+    count = (long)poke_checkpoints(5, 0);
+    poke_checkpoints(5, count);
+    values[0] = 5;              // the count
+    values[1] = 5 + count;      // the start of the last checkpoint
+    values[2] = 6 + count + 2;  // the outdegree of node 0
+    for (k = 0; k < 3 && rval == 0; k++) {
+        int64_t old = poke_checkpoints(values[k], values[k] == 5 ? count + 1 : -1);
+        if (bvgraph_load_checkpoints(&copy) == 0 || copy.checkpoints) {
+            fprintf(stderr, "\n ERROR loaded corrupt checkpoints\n");
+            rval = -1;
+        }
+        poke_checkpoints(values[k], old);
+    }
+    if (rval == 0 && bvgraph_load_checkpoints(&copy)) {
+        fprintf(stderr, "\n ERROR the restored checkpoints do not load\n");
+        rval = -1;
+    }
+    bvgraph_close(&copy);
+    return (rval);
+}
+
+/** Compare the current node of an iterator with random access.
+ * @return 0 on success
+ */
+static int check_node(bvgraph_iterator *iter, bvgraph_random_iterator *ri)
+{
+    int64_t *links, *rlinks;
+    uint64_t d, rd;
+    bvgraph_iterator_outedges(iter, &links, &d);
+    if (bvgraph_random_successors(ri, iter->curr, &rlinks, &rd) || d != rd ||
+        (d > 0 && memcmp(links, rlinks, sizeof(int64_t)*d) != 0)) {
+        fprintf(stderr, "\n ERROR on node %" PRId64 "\n", iter->curr);
+        return (-1);
+    }
+    return (0);
+}
+
+/** Seek an iterator over the copy to nodes in a scrambled order, and
+ * check each node and the nodes after it, which depend on the window.
+ * @return 0 on success
+ */
+static int check_seek(bvgraph *copy, bvgraph_random_iterator *ri)
+{
+    bvgraph_iterator iter;
+    int64_t i, j, x;
+    int rval = bvgraph_nonzero_iterator(copy, &iter);
+    if (rval) { return (rval); }
+    for (i = 0; i < 200 && rval == 0; i++) {
+        x = (i*7919) % copy->n;
+        rval = bvgraph_iterator_seek(&iter, x);
+        if (rval || iter.curr != x) {
+            fprintf(stderr, "\n ERROR seeking node %" PRId64 "\n", x);
+            rval = -1;
+            break;
+        }
+        for (j = 0; j < 10 && rval == 0 && bvgraph_iterator_valid(&iter); j++) {
+            rval = check_node(&iter, ri);
+            bvgraph_iterator_next(&iter);
+        }
+    }
+    bvgraph_iterator_free(&iter);
+    return (rval);
+}
+
+/** Check that parallel iterators started from the checkpoints cover the
+ * graph with the same split as parallel iterators without them.
+ * @return 0 on success
+ */
+static int check_parallel(bvgraph *copy, bvgraph_random_iterator *ri)
+{
+    bvgraph_parallel_iterators pits, cpits;
+    bvgraph_checkpoints *c = copy->checkpoints;
+    int k, s, nsteps, cnsteps, rval;
+    copy->checkpoints = NULL;
+    rval = bvgraph_parallel_iterators_create(copy, &pits, 4, 0, 1);
+    copy->checkpoints = c;
+    if (rval) { return (rval); }
+    rval = bvgraph_parallel_iterators_create(copy, &cpits, 4, 0, 1);
+    if (rval) { bvgraph_parallel_iterators_free(&pits); return (rval); }
+    if (pits.niters != cpits.niters) {
+        fprintf(stderr, "\n ERROR with %i and %i parallel iterators\n",
+            pits.niters, cpits.niters);
+        rval = -1;
+    }
+    for (k = 0; k < pits.niters && rval == 0; k++) {
+        bvgraph_iterator iter, citer;
+        bvgraph_parallel_iterator(&pits, k, &iter, &nsteps);
+        bvgraph_parallel_iterator(&cpits, k, &citer, &cnsteps);
+        if (iter.curr != citer.curr || nsteps != cnsteps) {
+            fprintf(stderr, "\n ERROR parallel iterator %i starts at %" PRId64
+                " instead of %" PRId64 "\n", k, citer.curr, iter.curr);
+            rval = -1;
+        }
+        for (s = 0; s < cnsteps && rval == 0; s++) {
+            rval = check_node(&citer, ri);
+            bvgraph_iterator_next(&citer);
+        }
+        bvgraph_iterator_free(&iter);
+        bvgraph_iterator_free(&citer);
+    }
+    bvgraph_parallel_iterators_free(&pits);
+    bvgraph_parallel_iterators_free(&cpits);
+    return (rval);
+}
+
+int main(int argc, char **argv)
+{
+    bvgraph graph = {0}, *g = &graph;
+    bvgraph_random_iterator ri;
+    const char *basename;
+    char name[1024];
+    int64_t steps[] = {1, 16, 1000};
+    int si, rval = 0;
+
+    if (argc < 2) {
+        fprintf(stderr, "Usage: checkpoint_test bvgraph_basename\n");
+        return (-1);
+    }
+    basename = argv[1];
+
+    if (bvgraph_load(g, basename, (unsigned int)strlen(basename), 1)) {
+        fprintf(stderr, "error loading %s\n", basename);
+        return (-1);
+    }
+    if (copy_graph_file(basename, ".graph") || copy_graph_file(basename, ".properties")) {
+        fprintf(stderr, "error copying %s\n", basename);
+        return (-1);
+    }
+    bvgraph_random_access_iterator(g, &ri);
+
+    printf("Testing checkpoints for %s ... ", basename);
+    for (si = 0; si < (int)(sizeof(steps)/sizeof(int64_t)) && rval == 0; si++) {
+        bvgraph copy = {0};
+        int offset_step;
+        for (offset_step = -1; offset_step <= 0 && rval == 0; offset_step++) {
+            rval = bvgraph_load(&copy, copyname, (unsigned int)strlen(copyname),
+                offset_step);
+            if (rval == 0 && offset_step == -1) {
+                rval = bvgraph_save_checkpoints(&copy, steps[si]);
+            }
+            if (rval == 0) { rval = bvgraph_load_checkpoints(&copy); }
+            if (rval) {
+                fprintf(stderr, "\n ERROR with checkpoints every %" PRId64
+                    " nodes\n", steps[si]);
+                break;
+            }
+            rval = check_seek(&copy, &ri);
+            if (rval == 0 && offset_step == 0) { rval = check_parallel(&copy, &ri); }
+            bvgraph_close(&copy);
+        }
+        if (rval == 0 && steps[si] >= 1000 && copy_file_size(".checkpoints") >=
+                (long)(sizeof(unsigned long long)*g->n)) {
+            fprintf(stderr, "\n ERROR the checkpoints take %li bytes\n",
+                copy_file_size(".checkpoints"));
+            rval = -1;
+        }
+    }
+    if (rval == 0) {
+        // checkpoints of another graph must not load
+        bvgraph copy = {0};
+        bvgraph_load(&copy, copyname, (unsigned int)strlen(copyname), 0);
+        copy.m++;
+        if (bvgraph_load_checkpoints(&copy) == 0) {
+            fprintf(stderr, "\n ERROR loaded checkpoints of another graph\n");
+            rval = -1;
+        }
+        bvgraph_close(&copy);
+    }
+    if (rval == 0) { rval = check_corrupt(); }
+
+    sprintf(name, "%s.checkpoints", copyname);
+    remove(name);
+    sprintf(name, "%s.graph", copyname);
+    remove(name);
+    sprintf(name, "%s.properties", copyname);
+    remove(name);
+    bvgraph_random_free(&ri);
+    bvgraph_close(g);
+
+    if (rval != 0) {
+        fprintf(stderr, "FAILED!\n");
+        return (-1);
+    } else {
+        printf("passed!\n");
+    }
+    return (0);
+}
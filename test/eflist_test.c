@@ -69,6 +69,34 @@ int test2() {
 	return 0;
 }
 
+/** A list whose first ones are far apart in the upper bits, so the
+ * select index has to spill */
+int test3() {
+    int64_t *A = NULL;
+    int64_t i = 0, n = 1000000;
+    elias_fano_list eflist;
+    A = malloc(sizeof(int64_t) * n);
+    A[0] = 0;
+    for (i = 1; i < n; i ++) {
+        A[i] = A[i-1] + (i < 3000 ? 10000000 : i % 3);
+    }
+    eflist_create(&eflist, n, A[n-1]);
+    eflist_addbatch(&eflist, A, n);
+    if (eflist.spill_curr == 0) {
+        printf("ERROR: eflist test did not spill!\n");
+        return (-1);
+    }
+    for (i = 0; i < n; i ++) {
+        if (A[i] != eflist_get(&eflist, i)) {
+            printf("ERROR: eflist test failed!\n");
+            return (-1);
+        }
+    }
+    eflist_free(&eflist);
+    free(A);
+    return 0;
+}
+
 int main(int argc, char **argv)
 {
     int rval = 0;
@@ -91,6 +119,16 @@ int main(int argc, char **argv)
         printf("  passed");
     }
     printf("\n");
+
+    printf("eflist test3 returns ");
+    rval |= test3();
+    printf("%i",rval);
+    if (rval != 0) {
+        printf("  FAILED");
+    } else {
+        printf("  passed");
+    }
+    printf("\n");
     
     return rval;
 }
@@ -0,0 +1,256 @@
+/*
+ * David Gleich
+ * Copyright, Stanford University, 2026
+ * 17 October 2026
+ */
+
+/**
+ * @file merge_bench.c
+ * Check merge_int_arrays and merge_int32_arrays and time them against
+ * the original branchy merge.
+ *
+ * The merges are taken from the degree distributions of the graphs: the
+ * successors of each node are split into two sorted lists, as a copied
+ * part and a residual part, and merged back together.
+ */
+
+/** History
+ *
+ * 2026-10-17: Initial version
+ *             Removed the SIMD kernels
+ */
+
+#include "bvgraph.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// disable all of the unsafe operation warnings
+#ifdef _MSC_VER
+#define inline __inline
+#if _MSC_VER >= 1400
+#pragma warning ( push )
+#pragma warning ( disable: 4996 )
+#endif /* _MSC_VER >= 1400 */
+#endif /* _MSC_VER */
+
+/** The original merge_int_arrays, for comparison */
+static void merge_branchy(const int64_t* a1, size_t a1len, const int64_t* a2,
+                          size_t a2len, int64_t *out)
+{
+    size_t a1i=0, a2i=0, oi=0;
+    while (a1i < a1len && a2i < a2len) {
+        out[oi++] = a1[a1i] < a2[a2i] ? a1[a1i++] : a2[a2i++];
+    }
+    if (a1i < a1len) {
+        memcpy(&out[oi], &a1[a1i], (a1len - a1i)*sizeof(int64_t));
+    } else {
+        memcpy(&out[oi], &a2[a2i], (a2len - a2i)*sizeof(int64_t));
+    }
+}
+
+/** The successor lists of a graph, split into two sorted lists each */
+struct merge_set {
+    int64_t n;          ///< the number of lists
+    int64_t *start;     ///< the start of each list in a, length n+1
+    int64_t *split;     ///< the length of the first part of each list
+    int64_t *a;         ///< the lists, each part sorted
+    uint32_t *a32;      ///< the lists with 32-bit ids
+    int64_t *sorted;    ///< the lists, sorted
+    int64_t nz;         ///< the total length of the lists
+};
+
+/** Split a sorted list into two sorted parts at random. */
+static int64_t split_list(const int64_t *list, int64_t d, int64_t *a)
+{
+    int64_t i, k = 0, j;
+    for (i = 0; i < d; i++) { if (rand() % 2) { a[k++] = list[i]; } }
+    j = k;
+    // the second part is every id not in the first part
+    for (i = 0, k = 0; i < d; i++) {
+        if (k < j && a[k] == list[i]) { k++; }
+        else { a[j + i - k] = list[i]; }
+    }
+    return (j);
+}
+
+/** Build the merges from the successor lists of a graph.
+ * @return 0 on success
+ */
+static int graph_merges(const char *filename, struct merge_set *s)
+{
+    bvgraph g = {0};
+    bvgraph_iterator iter;
+    int64_t *links, i;
+    uint64_t d;
+    if (bvgraph_load(&g, filename, (unsigned int)strlen(filename), 0)) {
+        return (-1);
+    }
+    s->n = g.n;
+    s->nz = g.m;
+    s->start = malloc(sizeof(int64_t)*(g.n+1));
+    s->split = malloc(sizeof(int64_t)*g.n);
+    s->a = malloc(sizeof(int64_t)*(g.m > 0 ? g.m : 1));
+    s->a32 = malloc(sizeof(uint32_t)*(g.m > 0 ? g.m : 1));
+    s->sorted = malloc(sizeof(int64_t)*(g.m > 0 ? g.m : 1));
+    s->start[0] = 0;
+    for (bvgraph_nonzero_iterator(&g, &iter);
+         bvgraph_iterator_valid(&iter);
+         bvgraph_iterator_next(&iter))
+    {
+        int64_t x = iter.curr;
+        bvgraph_iterator_outedges(&iter, &links, &d);
+        s->start[x+1] = s->start[x] + (int64_t)d;
+        memcpy(&s->sorted[s->start[x]], links, sizeof(int64_t)*d);
+        s->split[x] = split_list(links, (int64_t)d, &s->a[s->start[x]]);
+    }
+    bvgraph_iterator_free(&iter);
+    bvgraph_close(&g);
+    for (i = 0; i < s->nz; i++) { s->a32[i] = (uint32_t)s->a[i]; }
+    return (0);
+}
+
+/** Build random merges of every length up to maxlen.
+ */
+static void random_merges(int64_t maxlen, struct merge_set *s)
+{
+    int64_t x, i;
+    int64_t *list = malloc(sizeof(int64_t)*maxlen);
+    s->n = maxlen*maxlen;
+    s->nz = 0;
+    for (x = 0; x < maxlen; x++) { s->nz += x*maxlen; }
+    s->start = malloc(sizeof(int64_t)*(s->n+1));
+    s->split = malloc(sizeof(int64_t)*s->n);
+    s->a = malloc(sizeof(int64_t)*s->nz);
+    s->a32 = malloc(sizeof(uint32_t)*s->nz);
+    s->sorted = malloc(sizeof(int64_t)*s->nz);
+    s->start[0] = 0;
+    for (x = 0; x < s->n; x++) {
+        int64_t d = x / maxlen;
+        list[0] = rand() % 3;
+        for (i = 1; i < d; i++) { list[i] = list[i-1] + 1 + rand() % 5; }
+        s->start[x+1] = s->start[x] + d;
+        memcpy(&s->sorted[s->start[x]], list, sizeof(int64_t)*d);
+        s->split[x] = split_list(list, d, &s->a[s->start[x]]);
+    }
+    for (i = 0; i < s->nz; i++) { s->a32[i] = (uint32_t)s->a[i]; }
+    free(list);
+}
+
+static void free_merges(struct merge_set *s)
+{
+    free(s->start);
+    free(s->split);
+    free(s->a);
+    free(s->a32);
+    free(s->sorted);
+}
+
+/** The merge kernels timed by this benchmark */
+enum merge_kind { MERGE_BRANCHY, MERGE_64, MERGE_32 };
+
+/** Merge every list of a set.
+ * @return 0 if every merge is correct
+ */
+static int run_merges(struct merge_set *s, enum merge_kind kind,
+                      int64_t *out, uint32_t *out32, int check)
+{
+    int64_t x, i;
+    for (x = 0; x < s->n; x++) {
+        int64_t st = s->start[x], d = s->start[x+1] - st, k = s->split[x];
+        switch (kind) {
+            case MERGE_BRANCHY:
+                merge_branchy(&s->a[st], (size_t)k, &s->a[st+k], (size_t)(d-k), out);
+                break;
+            case MERGE_64:
+                merge_int_arrays(&s->a[st], (size_t)k, &s->a[st+k], (size_t)(d-k),
+                    out, (size_t)d);
+                break;
+            case MERGE_32:
+                merge_int32_arrays(&s->a32[st], (size_t)k, &s->a32[st+k],
+                    (size_t)(d-k), out32, (size_t)d);
+                break;
+        }
+        if (check) {
+            for (i = 0; i < d; i++) {
+                int64_t v = kind == MERGE_32 ? (int64_t)out32[i] : out[i];
+                if (v != s->sorted[st+i]) { return (-1); }
+            }
+        }
+    }
+    return (0);
+}
+
+/** Check and time the merges of a set with each kernel.
+ * @return 0 on success
+ */
+static int bench_merges(const char *name, struct merge_set *s, int reps)
+{
+    const char *names[] = {"branchy", "scalar 64", "scalar 32"};
+    enum merge_kind kinds[] = {MERGE_BRANCHY, MERGE_64, MERGE_32};
+    int64_t maxd = 0, x;
+    int64_t *out;
+    uint32_t *out32;
+    int k, r, rval = 0;
+    for (x = 0; x < s->n; x++) {
+        if (s->start[x+1] - s->start[x] > maxd) { maxd = s->start[x+1] - s->start[x]; }
+    }
+    out = malloc(sizeof(int64_t)*(maxd+1));
+    out32 = malloc(sizeof(uint32_t)*(maxd+1));
+    printf("%s: %lli merges of %lli ids\n", name, (long long)s->n, (long long)s->nz);
+    for (k = 0; k < 3; k++) {
+        clock_t t0;
+        double dt;
+        if (run_merges(s, kinds[k], out, out32, 1)) {
+            fprintf(stderr, "\n ERROR the %s merge is wrong on %s\n", names[k], name);
+            rval = -1;
+            continue;
+        }
+        t0 = clock();
+        for (r = 0; r < reps; r++) { run_merges(s, kinds[k], out, out32, 0); }
+        dt = (double)(clock() - t0)/CLOCKS_PER_SEC;
+        printf("  %-10s %8.3f ns per id\n", names[k],
+            s->nz > 0 ? 1e9*dt/((double)s->nz*reps) : 0.);
+    }
+    free(out);
+    free(out32);
+    return (rval);
+}
+
+int main(int argc, char **argv)
+{
+    struct merge_set s;
+    int i, reps = 100, rval = 0;
+
+    if (argc < 2) {
+        fprintf(stderr, "Usage: merge_bench [-r reps] bvgraph_basename ...\n");
+        return (-1);
+    }
+    srand(0);
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-r") == 0 && i+1 < argc) {
+            reps = atoi(argv[++i]);
+            continue;
+        }
+        if (graph_merges(argv[i], &s)) {
+            fprintf(stderr, "error loading %s\n", argv[i]);
+            return (-1);
+        }
+        rval |= bench_merges(argv[i], &s, reps);
+        free_merges(&s);
+    }
+    random_merges(64, &s);
+    rval |= bench_merges("random lists", &s, reps);
+    free_merges(&s);
+
+    if (rval != 0) {
+        fprintf(stderr, "FAILED!\n");
+        return (-1);
+    } else {
+        printf("passed!\n");
+    }
+    return (0);
+}
@@ -41,8 +41,19 @@ int main(void) {
   assert(bf->fill == 12);
   assert(refill16(bf) == 12);
   
+  // a long run of zeros in unary that spans several 64-bit words
+  unsigned char mem32[32] = {0};
+  mem32[25] = 16;
+  bitfile_map(mem32, 32, bf);
+  assert(bitfile_read_unary(bf) == 203);
+  assert(bitfile_tell(bf) == 204);
   
-  
+  // and a run that ends in the last byte after the word refills stop
+  mem32[25] = 0;
+  mem32[31] = 1;
+  bitfile_map(mem32, 32, bf);
+  assert(bitfile_read_unary(bf) == 255);
+  assert(bitfile_tell(bf) == 256);
   
   return 0;
 }
\ No newline at end of file
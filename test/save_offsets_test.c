@@ -0,0 +1,209 @@
+/*
+ * David Gleich
+ * Copyright, Stanford University, 2026
+ * 17 October 2026
+ */
+
+/**
+ * @file save_offsets_test.c
+ * Rebuild the offsets of a copy of a graph, save them with the
+ * BVGRAPH_LOAD_SAVE_OFFSETS and BVGRAPH_LOAD_SAVE_EF_OFFSETS flags, and
+ * check that loads from the saved files match.
+ */
+
+/** History
+ *
+ * 2026-10-17: Initial version
+ */
+
+#include "bvgraph.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+// disable all of the unsafe operation warnings
+#ifdef _MSC_VER
+#define inline __inline
+#if _MSC_VER >= 1400
+#pragma warning ( push )
+#pragma warning ( disable: 4996 )
+#endif /* _MSC_VER >= 1400 */
+#endif /* _MSC_VER */
+
+/** The base name for the copy of the graph */
+static const char *copyname = "save_offsets_tmp";
+
+/** Read a whole file.
+ * @param[in] filename the file
+ * @param[out] len the length of the file
+ * @return a malloc'ed buffer with the file, or NULL
+ */
+static unsigned char* read_file(const char *filename, size_t *len)
+{
+    unsigned char *buf = NULL;
+    long size;
+    FILE *f = fopen(filename, "rb");
+    if (!f) { return (NULL); }
+    fseek(f, 0, SEEK_END);
+    size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    buf = malloc(size > 0 ? (size_t)size : 1);
+    if (buf && fread(buf, 1, (size_t)size, f) != (size_t)size) {
+        free(buf);
+        buf = NULL;
+    }
+    fclose(f);
+    *len = (size_t)size;
+    return (buf);
+}
+
+/** Copy a file of the graph to the same file of the copy.
+ * @return 0 on success
+ */
+static int copy_graph_file(const char *basename, const char *ext)
+{
+    char src[1024], dst[1024];
+    size_t len;
+    unsigned char *buf;
+    FILE *f;
+    sprintf(src, "%s%s", basename, ext);
+    sprintf(dst, "%s%s", copyname, ext);
+    buf = read_file(src, &len);
+    if (!buf) { return (-1); }
+    f = fopen(dst, "wb");
+    if (!f || fwrite(buf, 1, len, f) != len) { free(buf); return (-1); }
+    fclose(f);
+    free(buf);
+    return (0);
+}
+
+/** Remove the saved offsets of the copy */
+static void remove_offsets(void)
+{
+    char name[1024];
+    sprintf(name, "%s.offsets", copyname);
+    remove(name);
+    sprintf(name, "%s.ef", copyname);
+    remove(name);
+}
+
+/** Check that a file of the copy exists */
+static int copy_has_file(const char *ext)
+{
+    char name[1024];
+    FILE *f;
+    sprintf(name, "%s%s", copyname, ext);
+    f = fopen(name, "rb");
+    if (f) { fclose(f); }
+    return (f != NULL);
+}
+
+/** Load the copy and compare its random access successors with a graph.
+ * @return 0 on success
+ */
+static int check_copy(bvgraph *g, int offset_step, int flags)
+{
+    bvgraph copy = {0};
+    bvgraph_random_iterator ri, cri;
+    int64_t *links, *clinks;
+    uint64_t d, cd;
+    int64_t i;
+    int rval = bvgraph_load_external(&copy, copyname, (unsigned int)strlen(copyname),
+        offset_step, NULL, 0, NULL, 0, flags);
+    if (rval) {
+        fprintf(stderr, "\n ERROR loading the copy with flags %i\n", flags);
+        return (-1);
+    }
+    bvgraph_random_access_iterator(g, &ri);
+    bvgraph_random_access_iterator(&copy, &cri);
+    for (i = 0; i < g->n && rval == 0; i++) {
+        bvgraph_random_successors(&ri, i, &links, &d);
+        rval = bvgraph_random_successors(&cri, i, &clinks, &cd);
+        if (rval || d != cd || memcmp(links, clinks, sizeof(int64_t)*d) != 0) {
+            fprintf(stderr, "\n ERROR on node %" PRId64 " with offset_step %i "
+                "and flags %i\n", i, offset_step, flags);
+            rval = -1;
+        }
+    }
+    bvgraph_random_free(&ri);
+    bvgraph_random_free(&cri);
+    bvgraph_close(&copy);
+    return (rval);
+}
+
+int main(int argc, char **argv)
+{
+    bvgraph graph = {0}, *g = &graph;
+    const char *basename;
+    char name[1024];
+    int rval = 0;
+
+    if (argc < 2) {
+        fprintf(stderr, "Usage: save_offsets_test bvgraph_basename\n");
+        return (-1);
+    }
+    basename = argv[1];
+
+    if (bvgraph_load(g, basename, (unsigned int)strlen(basename), 1)) {
+        fprintf(stderr, "error loading %s\n", basename);
+        return (-1);
+    }
+    if (copy_graph_file(basename, ".graph") || copy_graph_file(basename, ".properties")) {
+        fprintf(stderr, "error copying %s\n", basename);
+        return (-1);
+    }
+    remove_offsets();
+
+    printf("Testing saving offsets for %s ... ", basename);
+    rval |= check_copy(g, 1, BVGRAPH_LOAD_SAVE_OFFSETS|BVGRAPH_LOAD_SAVE_EF_OFFSETS);
+    if (!copy_has_file(".offsets") || !copy_has_file(".ef")) {
+        fprintf(stderr, "\n ERROR the offsets were not saved\n");
+        rval = -1;
+    }
+    {
+        // the saved offsets must be the WebGraph offsets
+        unsigned char *saved, *orig;
+        size_t savedlen, origlen;
+        sprintf(name, "%s.offsets", copyname);
+        saved = read_file(name, &savedlen);
+        sprintf(name, "%s.offsets", basename);
+        orig = read_file(name, &origlen);
+        if (orig && (!saved || savedlen != origlen || memcmp(saved, orig, origlen) != 0)) {
+            fprintf(stderr, "\n ERROR the saved offsets differ from %s\n", name);
+            rval = -1;
+        }
+        free(saved);
+        free(orig);
+    }
+    // load from the .offsets file
+    rval |= check_copy(g, 1, 0);
+    rval |= check_copy(g, 8, BVGRAPH_LOAD_EF_OFFSETS);
+
+    // load from the .ef file
+    sprintf(name, "%s.offsets", copyname);
+    remove(name);
+    rval |= check_copy(g, 1, BVGRAPH_LOAD_EF_OFFSETS);
+    rval |= check_copy(g, 1, 0);
+    rval |= check_copy(g, 8, 0);
+    if (copy_has_file(".offsets")) {
+        fprintf(stderr, "\n ERROR the offsets were saved without the flag\n");
+        rval = -1;
+    }
+
+    remove_offsets();
+    sprintf(name, "%s.graph", copyname);
+    remove(name);
+    sprintf(name, "%s.properties", copyname);
+    remove(name);
+    bvgraph_close(g);
+
+    if (rval != 0) {
+        fprintf(stderr, "FAILED!\n");
+        return (-1);
+    } else {
+        printf("passed!\n");
+    }
+    return (0);
+}
@@ -0,0 +1,306 @@
+/*
+ * David Gleich
+ * Copyright, Stanford University, 2026
+ * 17 October 2026
+ */
+
+/**
+ * @file shared_cache_test.c
+ * Query a graph from several threads with random access iterators that
+ * share one successor cache, and check every list against a sequential
+ * iterator.  A small cache forces evictions while lists are held.
+ * Sequential iterators then seek to nodes in the cache.
+ *
+ * With -b, also time queries of a small set of hot nodes, so every query
+ * finds its list and the threads only contend on the shard locks.
+ */
+
+/** History
+ *
+ * 2026-10-17: Initial version
+ *             Added the -b contention benchmark
+ *             Seek sequential iterators to nodes in the cache
+ */
+
+#include "bvgraph.h"
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+#include <pthread.h>
+#include <time.h>
+
+/** The number of query threads */
+#define NTHREADS 8
+
+/** The number of hot nodes and the queries of each thread in the 
+ * contention benchmark */
+#define HOT_NODES 256
+#define HOT_QUERIES 1000000
+
+/** The successors of every node, from a sequential iterator */
+struct adjacency {
+    int64_t n;
+    int64_t *rowstart;
+    int64_t *links;
+};
+
+/** The work of one query thread */
+struct query_thread {
+    bvgraph *g;
+    const struct adjacency *adj;
+    int id;
+    int rval;
+};
+
+/** Compare a list with the adjacency.
+ * @return 0 if they match
+ */
+static int check_list(const struct adjacency *adj, int64_t x,
+                      const int64_t *links, uint64_t d)
+{
+    int64_t st = adj->rowstart[x];
+    if ((int64_t)d != adj->rowstart[x+1] - st ||
+        (d > 0 && memcmp(links, &adj->links[st], sizeof(int64_t)*d) != 0)) {
+        fprintf(stderr, "\n ERROR on node %" PRId64 "\n", x);
+        return (-1);
+    }
+    return (0);
+}
+
+/** Seek sequential iterators to nodes whose lists are in the shared 
+ * cache, and check the lists from there on.
+ * @return 0 if they match
+ */
+static int check_seek(bvgraph *g, const struct adjacency *adj)
+{
+    bvgraph_iterator iter;
+    int64_t k, x, *links;
+    uint64_t d;
+    int rval = 0;
+    for (x = adj->n/7; x < adj->n && rval == 0; x += adj->n/7 + 1) {
+        rval = bvgraph_nonzero_iterator(g, &iter);
+        if (rval) { break; }
+        rval = bvgraph_iterator_seek(&iter, x);
+        for (k = 0; k < 50 && rval == 0 && bvgraph_iterator_valid(&iter); k++) {
+            bvgraph_iterator_outedges(&iter, &links, &d);
+            rval = check_list(adj, iter.curr, links, d);
+            bvgraph_iterator_next(&iter);
+        }
+        bvgraph_iterator_free(&iter);
+    }
+    return (rval);
+}
+
+/** Query the nodes twice in a scrambled order, with the queries of
+ * bvgraph_random_successors and with lists held across later queries.
+ */
+static void* run_queries(void *arg)
+{
+    struct query_thread *t = arg;
+    const struct adjacency *adj = t->adj;
+    bvgraph_random_iterator ri;
+    bvgraph_shared_list *held[4] = {NULL, NULL, NULL, NULL};
+    int64_t i, x, *links;
+    uint64_t d;
+    int k;
+
+    t->rval = bvgraph_random_access_iterator(t->g, &ri);
+    if (t->rval) { return (NULL); }
+    for (i = 0; i < 2*adj->n && t->rval == 0; i++) {
+        x = ((i + t->id*101)*7919) % adj->n;
+        if (i % 3 == 0) {
+            k = (int)(i % 4);
+            bvgraph_shared_list_release(held[k]);
+            held[k] = NULL;
+            t->rval = bvgraph_random_shared_successors(&ri, x, &held[k]);
+            if (t->rval == 0) {
+                t->rval = check_list(adj, x, held[k]->a, (uint64_t)held[k]->d);
+            }
+        } else {
+            t->rval = bvgraph_random_successors(&ri, x, &links, &d);
+            if (t->rval == 0) { t->rval = check_list(adj, x, links, d); }
+        }
+        // the held lists must survive evictions and later queries
+        for (k = 0; k < 4 && t->rval == 0; k++) {
+            if (held[k]) {
+                t->rval = check_list(adj, held[k]->x, held[k]->a,
+                    (uint64_t)held[k]->d);
+            }
+        }
+    }
+    for (k = 0; k < 4; k++) { bvgraph_shared_list_release(held[k]); }
+    bvgraph_random_free(&ri);
+    return (NULL);
+}
+
+/** Query the hot nodes HOT_QUERIES times.
+ */
+static void* run_hot_queries(void *arg)
+{
+    struct query_thread *t = arg;
+    bvgraph_random_iterator ri;
+    int64_t i, x, *links;
+    uint64_t d;
+
+    t->rval = bvgraph_random_access_iterator(t->g, &ri);
+    if (t->rval) { return (NULL); }
+    for (i = 0; i < HOT_QUERIES && t->rval == 0; i++) {
+        x = (((i + t->id*31) % HOT_NODES)*7919) % t->adj->n;
+        t->rval = bvgraph_random_successors(&ri, x, &links, &d);
+    }
+    bvgraph_random_free(&ri);
+    return (NULL);
+}
+
+/** The wall clock time in seconds */
+static double wall_time(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((double)ts.tv_sec + 1e-9*(double)ts.tv_nsec);
+}
+
+/** Time the queries of the hot nodes from 1 and from NTHREADS threads,
+ * with and without a shared cache, and print the time of each query.
+ * @return 0 on success
+ */
+static int bench_contention(const char *basename, const struct adjacency *adj)
+{
+    bvgraph graph = {0}, *g = &graph;
+    int nthreads[] = {1, NTHREADS};
+    int shared, ti, k, rval = 0;
+    printf("\n");
+    for (shared = 0; shared <= 1 && rval == 0; shared++) {
+        rval = bvgraph_load(g, basename, (unsigned int)strlen(basename), 1);
+        if (rval == 0 && shared) {
+            rval = bvgraph_shared_cache_create(g, (size_t)1 << 26, 0);
+        }
+        if (rval) { fprintf(stderr, "\n ERROR loading the graph\n"); break; }
+        for (ti = 0; ti < 2 && rval == 0; ti++) {
+            pthread_t threads[NTHREADS];
+            struct query_thread work[NTHREADS];
+            double t0 = wall_time(), dt;
+            for (k = 0; k < nthreads[ti]; k++) {
+                work[k].g = g;
+                work[k].adj = adj;
+                work[k].id = k;
+                work[k].rval = 0;
+                pthread_create(&threads[k], NULL, run_hot_queries, &work[k]);
+            }
+            for (k = 0; k < nthreads[ti]; k++) {
+                pthread_join(threads[k], NULL);
+                if (work[k].rval) { rval = work[k].rval; }
+            }
+            dt = wall_time() - t0;
+            printf("  %-12s %i threads: %8.1f ns per query\n",
+                shared ? "shared cache" : "no cache", nthreads[ti],
+                1e9*dt/((double)HOT_QUERIES*nthreads[ti]));
+        }
+        bvgraph_close(g);
+    }
+    return (rval);
+}
+
+/** Read the successors of every node with a sequential iterator.
+ * @return 0 on success
+ */
+static int load_adjacency(bvgraph *g, struct adjacency *adj)
+{
+    bvgraph_iterator iter;
+    int64_t *links;
+    uint64_t d;
+    int rval = bvgraph_nonzero_iterator(g, &iter);
+    if (rval) { return (rval); }
+    adj->n = g->n;
+    adj->rowstart = malloc(sizeof(int64_t)*(g->n+1));
+    adj->links = malloc(sizeof(int64_t)*(g->m > 0 ? g->m : 1));
+    if (!adj->rowstart || !adj->links) { return (-1); }
+    adj->rowstart[0] = 0;
+    for (; bvgraph_iterator_valid(&iter); bvgraph_iterator_next(&iter)) {
+        bvgraph_iterator_outedges(&iter, &links, &d);
+        adj->rowstart[iter.curr+1] = adj->rowstart[iter.curr] + (int64_t)d;
+        memcpy(&adj->links[adj->rowstart[iter.curr]], links, sizeof(int64_t)*d);
+    }
+    bvgraph_iterator_free(&iter);
+    return (0);
+}
+
+int main(int argc, char **argv)
+{
+    bvgraph graph = {0}, *g = &graph;
+    struct adjacency adj;
+    const char *basename;
+    size_t budgets[] = {8192, (size_t)1 << 26};
+    int bi, k, bench = 0, rval = 0;
+
+    if (argc > 1 && strcmp(argv[1], "-b") == 0) {
+        bench = 1;
+        argv++;
+        argc--;
+    }
+    if (argc < 2) {
+        fprintf(stderr, "Usage: shared_cache_test [-b] bvgraph_basename\n");
+        return (-1);
+    }
+    basename = argv[1];
+
+    if (bvgraph_load(g, basename, (unsigned int)strlen(basename), 0) ||
+        load_adjacency(g, &adj)) {
+        fprintf(stderr, "error loading %s\n", basename);
+        return (-1);
+    }
+    bvgraph_close(g);
+
+    printf("Testing the shared cache for %s ... ", basename);
+    for (bi = 0; bi < (int)(sizeof(budgets)/sizeof(size_t)) && rval == 0; bi++) {
+        pthread_t threads[NTHREADS];
+        struct query_thread work[NTHREADS];
+        uint64_t hits, misses;
+        size_t bytes;
+        rval = bvgraph_load(g, basename, (unsigned int)strlen(basename), 8);
+        if (rval == 0) { rval = bvgraph_shared_cache_create(g, budgets[bi], 4); }
+        if (rval) { fprintf(stderr, "\n ERROR creating the cache\n"); break; }
+        if (bvgraph_shared_cache_create(g, budgets[bi], 4) == 0) {
+            fprintf(stderr, "\n ERROR created a second cache\n");
+            rval = -1;
+        }
+        for (k = 0; k < NTHREADS; k++) {
+            work[k].g = g;
+            work[k].adj = &adj;
+            work[k].id = k;
+            work[k].rval = 0;
+            pthread_create(&threads[k], NULL, run_queries, &work[k]);
+        }
+        for (k = 0; k < NTHREADS; k++) {
+            pthread_join(threads[k], NULL);
+            if (work[k].rval) { rval = work[k].rval; }
+        }
+        bvgraph_shared_cache_stats(g, &hits, &misses, &bytes);
+        if (rval == 0 && bytes > budgets[bi]) {
+            fprintf(stderr, "\n ERROR the cache has %zu bytes\n", bytes);
+            rval = -1;
+        }
+        // every thread after the first to query a node finds it
+        if (rval == 0 && bi == 1 && hits < (uint64_t)(NTHREADS - 1)*adj.n) {
+            fprintf(stderr, "\n ERROR only %" PRIu64 " hits\n", hits);
+            rval = -1;
+        }
+        // a seek must not start from a list found in the cache
+        if (rval == 0) { rval = check_seek(g, &adj); }
+        bvgraph_close(g);
+    }
+    if (rval == 0 && bench) { rval = bench_contention(basename, &adj); }
+
+    free(adj.rowstart);
+    free(adj.links);
+
+    if (rval != 0) {
+        fprintf(stderr, "FAILED!\n");
+        return (-1);
+    } else {
+        printf("passed!\n");
+    }
+    return (0);
+}
@@ -7,11 +7,15 @@
 /**
  * @file bvpagerank.cc
  * Implement a few simple PageRank algorithms as tests of the library.
+ *
+ * 2026-10-17: Use bvgraph_foreach for the matrix-vector products
+ *             Decode on a helper thread in the power method
  */
 
 extern "C" {
 #include "bvgraph.h"
 }
+#include "bvgraph_foreach.hpp"
 
 #include <vector>
 #include <iostream>
@@ -201,32 +205,30 @@ double diff_norm_1(double* x, double *y, size_t n)
     return (rval);
 }
 
+/** Compute y += alpha*P'*x one node at a time */
+struct mult_visitor {
+    double *x, *y, alpha;
+    void operator()(int64_t v, const int64_t *links, uint64_t d) {
+        if (d == 0) { return; }
+        double id = 1.0/(double)d;
+        for (uint64_t i = 0; i < d; i++) {
+            y[links[i]] += alpha*x[v]*id;
+        }
+    }
+};
+
 int mult(bvgraph *g, double *x, double *y, double alpha)
 {
     using namespace std;
-    bvgraph_iterator git;
-    int rval = bvgraph_nonzero_iterator(g, &git);
+    mult_visitor visit = {x, y, alpha};
+    // decode the next chunks while this one is scattered into y
+    int rval = bvgraph_foreach_async(g, 4, visit);
     if (rval) {
-        cerr << "error: cannot get bvgraph iterator " << endl;
+        cerr << "error: cannot iterate over the bvgraph " << endl;
         cerr << "bvgraph error: " << bvgraph_error_string(rval) << endl;
         cerr << "halting iteration..." << endl;
         return (-1);
     }
-
-    int64_t *links; uint64_t i, d;
-    double id=0.0;
-
-    for (; 
-         bvgraph_iterator_valid(&git); 
-         bvgraph_iterator_next(&git))
-    {
-        bvgraph_iterator_outedges(&git, &links, &d);
-        if (d > 0) { id = 1.0/(double)d; }
-        for (i = 0; i < d; i++) {
-            y[links[i]] += alpha*x[git.curr]*id;
-        }
-    }
-    bvgraph_iterator_free(&git);
     return (0);
 }
 
@@ -271,29 +273,14 @@ void power_alg(bvgraph *g, double alpha, double tol, int maxit, std::vector<doub
 int dangling_mult(bvgraph *g, double *x, double *y, size_t n)
 {
     using namespace std;
-    bvgraph_iterator git;
-    int rval = bvgraph_nonzero_iterator(g, &git);
+    mult_visitor visit = {x, y, 1.0};
+    int rval = bvgraph_foreach(g, 0, g->n, visit);
     if (rval) {
-        cerr << "error: cannot get bvgraph iterator" << endl;
+        cerr << "error: cannot iterate over the bvgraph" << endl;
         cerr << "bvgraph error: " << bvgraph_error_string(rval) << endl;
         cerr << "halting iteration..." << endl;
         return (-1);
     }
-
-    int64_t *links; uint64_t i, d;
-    double id=0.0;
-
-    for (; 
-         bvgraph_iterator_valid(&git); 
-         bvgraph_iterator_next(&git))
-    {
-        bvgraph_iterator_outedges(&git, &links, &d);
-        if (d > 0) { id = 1.0/(double)d; }
-        for (i = 0; i < d; i++) {
-            y[links[i]] += x[git.curr]*id;
-        }
-    }
-    bvgraph_iterator_free(&git);
     double w = 1.0 - sum(y,g->n);
     shift(y, w*(1.0/(double)g->n), g->n);
     return (0);
@@ -393,36 +380,34 @@ double compute_pagerank_residual(double *y, double alpha, double nx, double dtx,
     return (rval);
 }
 
+/** One step of the updated Richardson iteration one node at a time */
+struct richardson_visitor {
+    double *x, *y, alpha;
+    double nx, dtx;
+    void operator()(int64_t v, const int64_t *links, uint64_t d) {
+        double yj = y[v]; x[v] += yj; nx += x[v];
+        double id = 0.0;
+        if (d > 0) { id = 1.0/(double)d; }
+        else { dtx += x[v]; }
+        for (uint64_t i = 0; i < d; i++) {
+            y[links[i]] += yj*alpha*id;
+        }
+        y[v] -= yj;
+    }
+};
+
 int updated_richardson_iter(bvgraph *g, double *x, double *y, double alpha, size_t n, double *pnx, double *pdtx)
 {
-    double nx=0.0, dtx=0.0;
     using namespace std;
-    bvgraph_iterator git;
-    int rval = bvgraph_nonzero_iterator(g, &git);
+    richardson_visitor visit = {x, y, alpha, 0.0, 0.0};
+    int rval = bvgraph_foreach(g, 0, g->n, visit);
     if (rval) {
-        cerr << "error: cannot get bvgraph iterator" << endl;
+        cerr << "error: cannot iterate over the bvgraph" << endl;
         cerr << "bvgraph error: " << bvgraph_error_string(rval) << endl;
         cerr << "halting iteration..." << endl;
         return (-1);
     }
-
-    int64_t *links; uint64_t i, d;
-    double id=0.0;
-
-    for (; 
-         bvgraph_iterator_valid(&git); 
-         bvgraph_iterator_next(&git))
-    {
-        bvgraph_iterator_outedges(&git, &links, &d);
-        double yj = y[git.curr]; x[git.curr] += yj; nx += x[git.curr];
-        if (d > 0) { id = 1.0/(double)d; }
-        else { dtx += x[git.curr]; }
-        for (i = 0; i < d; i++) {
-            y[links[i]] += yj*alpha*id;
-        }
-        y[git.curr] -= yj;
-    }
-    bvgraph_iterator_free(&git);
+    double nx = visit.nx, dtx = visit.dtx;
     if (pnx) { *pnx = nx; }
     if (pdtx) { *pdtx = dtx; }
     return (0);